@@ -136,6 +136,7 @@ static const zone_type_id zone_type_LOOT_CORPSE( "LOOT_CORPSE" );
 static const zone_type_id zone_type_LOOT_CUSTOM( "LOOT_CUSTOM" );
 static const zone_type_id zone_type_LOOT_IGNORE( "LOOT_IGNORE" );
 static const zone_type_id zone_type_LOOT_IGNORE_FAVORITES( "LOOT_IGNORE_FAVORITES" );
+static const zone_type_id zone_type_LOOT_ITEM_GROUP( "LOOT_ITEM_GROUP" );
 static const zone_type_id zone_type_LOOT_UNSORTED( "LOOT_UNSORTED" );
 static const zone_type_id zone_type_LOOT_WOOD( "LOOT_WOOD" );
 static const zone_type_id zone_type_MINING( "MINING" );
@@ -2201,6 +2202,15 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             unload_always |= options.unload_always();
         }
 
+        // These don't depend on the item, so look them up once for the whole tile
+        const faction_id fac_id = _fac_id( you );
+        const bool ignore_favorites = mgr.has( zone_type_LOOT_IGNORE_FAVORITES, src, fac_id );
+        const bool near_unload_all = mgr.has_near( zone_type_UNLOAD_ALL, abspos, 1, fac_id );
+        const bool near_strip_corpses = mgr.has_near( zone_type_STRIP_CORPSES, abspos, 1, fac_id );
+        // Destinations of zone types that accept any item, shared by all items on the tile
+        std::unordered_map<zone_type_id, std::unordered_set<tripoint_abs_ms>> dest_cache;
+        std::unordered_set<tripoint_abs_ms> custom_dest_set;
+
         //Skip items that have already been processed
         for( auto it = items.begin() + num_processed; it < items.end(); ++it ) {
             ++num_processed;
@@ -2217,29 +2227,36 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             }
 
             // skip favorite items in ignore favorite zones
-            if( thisitem.is_favorite && mgr.has( zone_type_LOOT_IGNORE_FAVORITES, src, _fac_id( you ) ) ) {
+            if( thisitem.is_favorite && ignore_favorites ) {
                 continue;
             }
 
             // Only if it's from a vehicle do we use the vehicle source location information.
             const std::optional<vpart_reference> vpr_src = it->second ? vpr : std::nullopt;
             const zone_type_id id = mgr.get_near_zone_type_for_item( thisitem, abspos,
-                                    ACTIVITY_SEARCH_DISTANCE, _fac_id( you ) );
+                                    ACTIVITY_SEARCH_DISTANCE, fac_id );
 
             // checks whether the item is already on correct loot zone or not
             // if it is, we can skip such item, if not we move the item to correct pile
             // think empty bag on food pile, after you ate the content
-            if( id != zone_type_LOOT_CUSTOM && mgr.has( id, src, _fac_id( you ) ) ) {
+            if( id != zone_type_LOOT_CUSTOM && mgr.has( id, src, fac_id ) ) {
                 continue;
             }
 
             if( id == zone_type_LOOT_CUSTOM &&
-                mgr.custom_loot_has( src, &thisitem, zone_type_LOOT_CUSTOM, _fac_id( you ) ) ) {
+                mgr.custom_loot_has( src, &thisitem, zone_type_LOOT_CUSTOM, fac_id ) ) {
                 continue;
             }
 
-            const std::unordered_set<tripoint_abs_ms> dest_set =
-                mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE, &thisitem, _fac_id( you ) );
+            const bool item_specific_dest = id == zone_type_LOOT_CUSTOM || id == zone_type_LOOT_ITEM_GROUP;
+            if( item_specific_dest ) {
+                custom_dest_set = mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE, &thisitem, fac_id );
+            } else if( dest_cache.count( id ) == 0 ) {
+                dest_cache.emplace( id, mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE, nullptr,
+                                                      fac_id ) );
+            }
+            const std::unordered_set<tripoint_abs_ms> &dest_set = item_specific_dest ? custom_dest_set :
+                    dest_cache.at( id );
 
             // if this item isn't going anywhere and its not sealed
             // check if it is in a unload zone or a strip corpse zone
@@ -2247,8 +2264,7 @@ void activity_on_turn_move_loot( player_activity &act, Character &you )
             bool move_and_reset = false;
             bool moved_something = false;
 
-            if( mgr.has_near( zone_type_UNLOAD_ALL, abspos, 1, _fac_id( you ) ) ||
-                ( mgr.has_near( zone_type_STRIP_CORPSES, abspos, 1, _fac_id( you ) ) && it->first->is_corpse() ) ) {
+            if( near_unload_all || ( near_strip_corpses && it->first->is_corpse() ) ) {
                 if( dest_set.empty() || unload_always ) {
                     if( you.rate_action_unload( *it->first ) == hint_rating::good &&
                         !it->first->any_pockets_sealed() ) {
@@ -16,6 +16,7 @@ bool use_far_tiles;
 bool use_pinyin_search;
 bool use_tiles_overmap;
 test_mode_spilling_action_t test_mode_spilling_action = test_mode_spilling_action_t::spill_all;
+bool data_snapshot = false;
 bool direct3d_mode;
 bool pixel_minimap_option;
 int pixel_minimap_r;
@@ -44,6 +44,10 @@ enum class test_mode_spilling_action_t {
 };
 extern test_mode_spilling_action_t test_mode_spilling_action;
 
+// data_snapshot is not a regular game option either; when it's set, each data folder is
+// loaded from one snapshot of its parsed json files if none of them changed since the last run.
+extern bool data_snapshot;
+
 extern bool direct3d_mode;
 
 enum class error_log_format_t {
@@ -245,10 +245,11 @@ void cata_tiles::on_options_changed()
 void tileset::clear()
 {
     tile_values.clear();
-    shadow_tile_values.clear();
-    night_tile_values.clear();
-    overexposed_tile_values.clear();
-    memory_tile_values.clear();
+    atlas_pages.clear();
+    tile_pages.clear();
+    for( std::vector<texture> &values : filtered_tile_values ) {
+        values.clear();
+    }
     duplicate_ids.clear();
     tile_ids.clear();
     for( std::unordered_map<std::string, season_tile_value> &m : tile_ids_by_season ) {
@@ -332,6 +333,7 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
     tileset_mutation_overlay_ordering.clear();
 
     tileset_ptr = cache.load_tileset( tileset_id, renderer, precheck, force, pump_events );
+    clear_tile_lookup_cache();
 
     set_draw_scale( 16 );
 
@@ -345,6 +347,32 @@ void cata_tiles::reinit()
 {
     set_draw_scale( 16 );
     RenderClear( renderer );
+    clear_tile_lookup_cache();
+}
+
+void cata_tiles::clear_tile_lookup_cache()
+{
+    for( tile_lookup_table_t &category_table : tile_lookup_table ) {
+        category_table.clear();
+    }
+    for( tile_lookup_cache_t &category_cache : tile_lookup_cache ) {
+        category_cache.clear();
+    }
+    tile_lookup_tileset = nullptr;
+}
+
+void cata_tiles::validate_tile_lookup_cache()
+{
+    if( tile_lookup_tileset == tileset_ptr.get() && tile_lookup_turn == calendar::turn ) {
+        return;
+    }
+    const season_type season = season_of_year( calendar::turn );
+    if( tile_lookup_tileset != tileset_ptr.get() || tile_lookup_season != season ) {
+        clear_tile_lookup_cache();
+        tile_lookup_tileset = tileset_ptr.get();
+        tile_lookup_season = season;
+    }
+    tile_lookup_turn = calendar::turn;
 }
 
 static void get_tile_information( const cata_path &config_path, std::string &json_path,
@@ -396,15 +424,21 @@ static void get_tile_information( const cata_path &config_path, std::string &jso
     }
 }
 
-template<typename PixelConverter>
-static SDL_Surface_Ptr apply_color_filter( const SDL_Surface_Ptr &original,
-        PixelConverter pixel_converter )
+static SDL_Surface_Ptr copy_surface_32( const SDL_Surface_Ptr &original )
 {
     cata_assert( original );
     SDL_Surface_Ptr surf = create_surface_32( original->w, original->h );
     cata_assert( surf );
     throwErrorIf( SDL_BlitSurface( original.get(), nullptr, surf.get(), nullptr ) != 0,
                   "SDL_BlitSurface failed" );
+    return surf;
+}
+
+template<typename PixelConverter>
+static SDL_Surface_Ptr apply_color_filter( const SDL_Surface_Ptr &original,
+        PixelConverter pixel_converter )
+{
+    SDL_Surface_Ptr surf = copy_surface_32( original );
 
     SDL_Color *pix = static_cast<SDL_Color *>( surf->pixels );
 
@@ -430,8 +464,8 @@ static bool is_contained( const SDL_Rect &smaller, const SDL_Rect &larger )
            smaller.y + smaller.h <= larger.y + larger.h;
 }
 
-void tileset_cache::loader::copy_surface_to_texture( const SDL_Surface_Ptr &surf,
-        const point &offset, std::vector<texture> &target )
+std::vector<std::pair<size_t, SDL_Rect>> tileset_cache::loader::copy_surface_to_texture(
+        const SDL_Surface_Ptr &surf, const point &offset, std::vector<texture> &target )
 {
     cata_assert( surf );
     const rect_range<SDL_Rect> input_range( sprite_width, sprite_height,
@@ -441,6 +475,7 @@ void tileset_cache::loader::copy_surface_to_texture( const SDL_Surface_Ptr &surf
     const std::shared_ptr<SDL_Texture> texture_ptr = CreateTextureFromSurface( renderer, surf );
     cata_assert( texture_ptr );
 
+    std::vector<std::pair<size_t, SDL_Rect>> sprites;
     for( const SDL_Rect rect : input_range ) {
         cata_assert( offset.x % sprite_width == 0 );
         cata_assert( offset.y % sprite_height == 0 );
@@ -452,7 +487,9 @@ void tileset_cache::loader::copy_surface_to_texture( const SDL_Surface_Ptr &surf
         cata_assert( index < target.size() );
         cata_assert( target[index].dimension() == std::make_pair( 0, 0 ) );
         target[index] = texture( texture_ptr, rect );
+        sprites.emplace_back( index, rect );
     }
+    return sprites;
 }
 
 void tileset_cache::loader::create_textures_from_tile_atlas( const SDL_Surface_Ptr &tile_atlas,
@@ -460,28 +497,44 @@ void tileset_cache::loader::create_textures_from_tile_atlas( const SDL_Surface_P
 {
     cata_assert( tile_atlas );
 
-    /** perform color filter conversion here */
-    using tiles_pixel_color_entry = std::tuple<std::vector<texture>*, std::string>;
-    std::array<tiles_pixel_color_entry, 5> tile_values_data = {{
-            { std::make_tuple( &ts.tile_values, "color_pixel_none" ) },
-            { std::make_tuple( &ts.shadow_tile_values, "color_pixel_grayscale" ) },
-            { std::make_tuple( &ts.night_tile_values, "color_pixel_nightvision" ) },
-            { std::make_tuple( &ts.overexposed_tile_values, "color_pixel_overexposed" ) },
-            { std::make_tuple( &ts.memory_tile_values, tilecontext->memory_map_mode ) }
-        }
-    };
-    for( tiles_pixel_color_entry &entry : tile_values_data ) {
-        std::vector<texture> *tile_values = std::get<0>( entry );
-        color_pixel_function_pointer color_pixel_function = get_color_pixel_function( std::get<1>
-                ( entry ) );
-        if( !color_pixel_function ) {
-            // TODO: Move it inside apply_color_filter.
-            copy_surface_to_texture( tile_atlas, offset, *tile_values );
-        } else {
-            copy_surface_to_texture( apply_color_filter( tile_atlas, color_pixel_function ), offset,
-                                     *tile_values );
+    // Only the unfiltered texture is created here, the color filtered ones are
+    // created from the kept copy of the page in tileset::get_filtered_tile.
+    tileset::atlas_page page;
+    page.sprites = copy_surface_to_texture( tile_atlas, offset, ts.tile_values );
+    page.surface = copy_surface_32( tile_atlas );
+    const int page_index = static_cast<int>( ts.atlas_pages.size() );
+    for( const std::pair<size_t, SDL_Rect> &sprite : page.sprites ) {
+        ts.tile_pages[sprite.first] = page_index;
+    }
+    ts.atlas_pages.emplace_back( std::move( page ) );
+}
+
+const texture *tileset::get_filtered_tile( const color_filter filter, const size_t index,
+        const SDL_Renderer_Ptr &renderer ) const
+{
+    const color_pixel_function_pointer color_pixel_function =
+        color_filter_functions[static_cast<size_t>( filter )];
+    if( !color_pixel_function ) {
+        return get_tile( index );
+    }
+    if( index >= tile_pages.size() || tile_pages[index] < 0 ) {
+        return nullptr;
+    }
+    std::vector<texture> &values = filtered_tile_values[static_cast<size_t>( filter )];
+    if( values.size() < tile_pages.size() ) {
+        values.resize( tile_pages.size() );
+    }
+    if( values[index].dimension() == std::make_pair( 0, 0 ) ) {
+        // First use of this filter on the page, create the texture for all its sprites
+        const atlas_page &page = atlas_pages[tile_pages[index]];
+        const std::shared_ptr<SDL_Texture> texture_ptr = CreateTextureFromSurface( renderer,
+                apply_color_filter( page.surface, color_pixel_function ) );
+        cata_assert( texture_ptr );
+        for( const std::pair<size_t, SDL_Rect> &sprite : page.sprites ) {
+            values[sprite.first] = texture( texture_ptr, sprite.second );
         }
     }
+    return &values[index];
 }
 
 template<typename T>
@@ -560,10 +613,7 @@ void tileset_cache::loader::load_tileset( const cata_path &img_path, const bool
     const int expected_tilecount = ( tile_atlas->w / sprite_width ) *
                                    ( tile_atlas->h / sprite_height );
     extend_vector_by( ts.tile_values, expected_tilecount );
-    extend_vector_by( ts.shadow_tile_values, expected_tilecount );
-    extend_vector_by( ts.night_tile_values, expected_tilecount );
-    extend_vector_by( ts.overexposed_tile_values, expected_tilecount );
-    extend_vector_by( ts.memory_tile_values, expected_tilecount );
+    ts.tile_pages.resize( ts.tile_pages.size() + expected_tilecount, -1 );
 
     for( const SDL_Rect sub_rect : output_range ) {
         cata_assert( sub_rect.x % sprite_width == 0 );
@@ -685,6 +735,13 @@ void tileset_cache::loader::load( const std::string &tileset_id, const bool prec
     }
 
     ts.clear();
+    ts.color_filter_functions = {{
+            get_color_pixel_function( "color_pixel_grayscale" ),
+            get_color_pixel_function( "color_pixel_nightvision" ),
+            get_color_pixel_function( "color_pixel_overexposed" ),
+            get_color_pixel_function( tilecontext->memory_map_mode )
+        }
+    };
 
     // Load tile information if available.
     offset = 0;
@@ -2301,6 +2358,65 @@ cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
     }
 }
 
+static std::string tile_id_of_form( const std::string &id, const int form )
+{
+    if( form < 0 ) {
+        return id + "_transparent";
+    } else if( form > 0 ) {
+        return id + "_int" + std::to_string( form );
+    }
+    return id;
+}
+
+std::optional<tile_lookup_res>
+cata_tiles::find_tile_looks_like_cached( const std::string &id, TILE_CATEGORY category,
+        const std::string &variant, const int id_index, const int form )
+{
+    validate_tile_lookup_cache();
+    if( id_index >= 0 && variant.empty() ) {
+        tile_lookup_table_t &table = tile_lookup_table[static_cast<size_t>( category )];
+        if( table.size() <= static_cast<size_t>( id_index ) ) {
+            table.resize( id_index + 1 );
+        }
+        std::vector<resolved_tile> &forms = table[id_index];
+        const size_t slot = form + 1;
+        if( forms.size() <= slot ) {
+            forms.resize( slot + 1 );
+        }
+        resolved_tile &entry = forms[slot];
+        if( !entry.resolved ) {
+            entry.tile = find_tile_looks_like( tile_id_of_form( id, form ), category, variant );
+            entry.resolved = true;
+        }
+        return entry.tile;
+    }
+    tile_lookup_cache_t &category_cache = tile_lookup_cache[static_cast<size_t>( category )];
+    // Found by reference, so no strings are copied unless the result isn't known yet
+    auto by_id = form == 0 ? category_cache.find( id ) :
+                 category_cache.find( tile_id_of_form( id, form ) );
+    if( by_id == category_cache.end() ) {
+        by_id = category_cache.emplace( tile_id_of_form( id, form ),
+                                        tile_lookup_cache_t::mapped_type() ).first;
+    }
+    auto iter = by_id->second.find( variant );
+    if( iter == by_id->second.end() ) {
+        iter = by_id->second.emplace( variant, find_tile_looks_like( by_id->first, category,
+                                      variant ) ).first;
+    }
+    return iter->second;
+}
+
+template<typename T>
+bool cata_tiles::draw_from_int_id( const int_id<T> &id, TILE_CATEGORY category,
+                                   const tripoint &pos, int subtile, int rota, lit_level ll,
+                                   bool apply_night_vision_goggles, int &height_3d,
+                                   int intensity_level )
+{
+    return draw_from_id_string_internal( id.id().str(), category, empty_string, pos, subtile, rota,
+                                         ll, -1, apply_night_vision_goggles, height_3d,
+                                         intensity_level, "", point(), id.to_i() );
+}
+
 bool cata_tiles::find_overlay_looks_like( const bool male, const std::string &overlay,
         const std::string &variant, std::string &draw_id )
 {
@@ -2372,7 +2488,7 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
         int subtile, int rota, lit_level ll, int retract,
         bool apply_night_vision_goggles, int &height_3d,
         int intensity_level, const std::string &variant,
-        const point &offset )
+        const point &offset, const int id_index )
 {
     bool nv_color_active = apply_night_vision_goggles && get_option<bool>( "NV_GREEN_TOGGLE" );
     // If the ID string does not produce a drawable tile
@@ -2404,7 +2520,7 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
         }
 
         if( prevent_occlusion_transp && retract > 0 ) {
-            res = find_tile_looks_like( id + "_transparent", category, variant );
+            res = find_tile_looks_like_cached( id, category, variant, id_index, -1 );
             if( res ) {
                 tt = &res -> tile();
             }
@@ -2414,14 +2530,14 @@ bool cata_tiles::draw_from_id_string_internal( const std::string &id, TILE_CATEG
     // check if there is an available intensity tile and if there is use that instead of the basic tile
     // this is only relevant for fields
     if( intensity_level > 0 ) {
-        res = find_tile_looks_like( id + "_int" + std::to_string( intensity_level ), category, variant );
+        res = find_tile_looks_like_cached( id, category, variant, id_index, intensity_level );
         if( res ) {
             tt = &res -> tile();
         }
     }
     // if a tile with intensity hasn't already been found then fall back to a base tile
     if( !res ) {
-        res = find_tile_looks_like( id, category, variant );
+        res = find_tile_looks_like_cached( id, category, variant, id_index, 0 );
         if( res ) {
             tt = &res -> tile();
         }
@@ -2839,21 +2955,25 @@ bool cata_tiles::draw_sprite_at(
     //use night vision colors when in use
     //then use low light tile if available
     if( ll == lit_level::MEMORIZED ) {
-        if( const texture *ptr = tileset_ptr->get_memory_tile( sprite_index ) ) {
+        if( const texture *ptr = tileset_ptr->get_filtered_tile( tileset::color_filter::memory,
+                                 sprite_index, renderer ) ) {
             sprite_tex = ptr;
         }
     } else if( apply_night_vision_goggles ) {
         if( ll != lit_level::LOW ) {
-            if( const texture *ptr = tileset_ptr->get_overexposed_tile( sprite_index ) ) {
+            if( const texture *ptr = tileset_ptr->get_filtered_tile(
+                                         tileset::color_filter::overexposed, sprite_index, renderer ) ) {
                 sprite_tex = ptr;
             }
         } else {
-            if( const texture *ptr = tileset_ptr->get_night_tile( sprite_index ) ) {
+            if( const texture *ptr = tileset_ptr->get_filtered_tile( tileset::color_filter::night,
+                                     sprite_index, renderer ) ) {
                 sprite_tex = ptr;
             }
         }
     } else if( ll == lit_level::LOW ) {
-        if( const texture *ptr = tileset_ptr->get_shadow_tile( sprite_index ) ) {
+        if( const texture *ptr = tileset_ptr->get_filtered_tile( tileset::color_filter::shadow,
+                                 sprite_index, renderer ) ) {
             sprite_tex = ptr;
         }
     }
@@ -3175,8 +3295,8 @@ bool cata_tiles::draw_terrain( const tripoint &p, const lit_level ll, int &heigh
         if( !neighborhood_overridden ) {
             return memorize_only
                    ? false
-                   : draw_from_id_string( tname, TILE_CATEGORY::TERRAIN, empty_string, p, subtile,
-                                          rotation, ll, nv_goggles_activated, height_3d );
+                   : draw_from_int_id( t, TILE_CATEGORY::TERRAIN, p, subtile, rotation, ll,
+                                       nv_goggles_activated, height_3d );
         }
     }
     if( invisible[0] ? overridden : neighborhood_overridden ) {
@@ -3195,15 +3315,14 @@ bool cata_tiles::draw_terrain( const tripoint &p, const lit_level ll, int &heigh
             } else {
                 get_terrain_orientation( p, rotation, subtile, terrain_override, invisible, rotate_group );
             }
-            const std::string &tname = t2.id().str();
             // tile overrides are never memorized
             // tile overrides are always shown with full visibility
             const lit_level lit = overridden ? lit_level::LIT : ll;
             const bool nv = overridden ? false : nv_goggles_activated;
             return memorize_only
                    ? false
-                   : draw_from_id_string( tname, TILE_CATEGORY::TERRAIN, empty_string, p, subtile,
-                                          rotation, lit, nv, height_3d );
+                   : draw_from_int_id( t2, TILE_CATEGORY::TERRAIN, p, subtile, rotation, lit, nv,
+                                       height_3d );
         }
     } else if( invisible[0] ) {
         // try drawing memory if invisible and not overridden
@@ -3264,8 +3383,8 @@ bool cata_tiles::draw_furniture( const tripoint &p, const lit_level ll, int &hei
         if( !neighborhood_overridden ) {
             return memorize_only
                    ? false
-                   : draw_from_id_string( fname, TILE_CATEGORY::FURNITURE, empty_string, p, subtile,
-                                          rotation, ll, nv_goggles_activated, height_3d );
+                   : draw_from_int_id( f, TILE_CATEGORY::FURNITURE, p, subtile, rotation, ll,
+                                       nv_goggles_activated, height_3d );
         }
     }
     if( invisible[0] ? overridden : neighborhood_overridden ) {
@@ -3296,15 +3415,14 @@ bool cata_tiles::draw_furniture( const tripoint &p, const lit_level ll, int &hei
                 get_tile_values_with_ter( p, f.to_i(), neighborhood, subtile, rotation, rotate_group );
             }
             get_tile_values_with_ter( p, f2.to_i(), neighborhood, subtile, rotation, 0 );
-            const std::string &fname = f2.id().str();
             // tile overrides are never memorized
             // tile overrides are always shown with full visibility
             const lit_level lit = overridden ? lit_level::LIT : ll;
             const bool nv = overridden ? false : nv_goggles_activated;
             return memorize_only
                    ? false
-                   : draw_from_id_string( fname, TILE_CATEGORY::FURNITURE, empty_string, p, subtile,
-                                          rotation, lit, nv, height_3d );
+                   : draw_from_int_id( f2, TILE_CATEGORY::FURNITURE, p, subtile, rotation, lit, nv,
+                                       height_3d );
         }
     } else if( invisible[0] ) {
         // try drawing memory if invisible and not overridden
@@ -3349,7 +3467,7 @@ bool cata_tiles::draw_trap( const tripoint &p, const lit_level ll, int &height_3
         int subtile = 0;
         int rotation = 0;
         get_tile_values( tr.loadid.to_i(), neighborhood, subtile, rotation, 0 );
-        const std::string trname = tr.loadid.id().str();
+        const std::string &trname = tr.loadid.id().str();
         if( here.memory_cache_dec_is_dirty( p ) ) {
             you.memorize_decoration( here.getglobal( p ), trname, subtile, rotation );
         }
@@ -3357,8 +3475,8 @@ bool cata_tiles::draw_trap( const tripoint &p, const lit_level ll, int &height_3
         if( !neighborhood_overridden ) {
             return memorize_only
                    ? false
-                   : draw_from_id_string( trname, TILE_CATEGORY::TRAP, empty_string, p, subtile,
-                                          rotation, ll, nv_goggles_activated, height_3d );
+                   : draw_from_int_id( tr.loadid, TILE_CATEGORY::TRAP, p, subtile, rotation, ll,
+                                       nv_goggles_activated, height_3d );
         }
     }
     if( overridden || ( !invisible[0] && neighborhood_overridden &&
@@ -3382,15 +3500,14 @@ bool cata_tiles::draw_trap( const tripoint &p, const lit_level ll, int &height_3
             int subtile = 0;
             int rotation = 0;
             get_tile_values( tr2.to_i(), neighborhood, subtile, rotation, 0 );
-            const std::string &trname = tr2.id().str();
             // tile overrides are never memorized
             // tile overrides are always shown with full visibility
             const lit_level lit = overridden ? lit_level::LIT : ll;
             const bool nv = overridden ? false : nv_goggles_activated;
             return memorize_only
                    ? false
-                   : draw_from_id_string( trname, TILE_CATEGORY::TRAP, empty_string, p, subtile,
-                                          rotation, lit, nv, height_3d );
+                   : draw_from_int_id( tr2, TILE_CATEGORY::TRAP, p, subtile, rotation, lit, nv,
+                                       height_3d );
         }
     } else if( invisible[0] ) {
         // try drawing memory if invisible and not overridden
@@ -3564,8 +3681,8 @@ bool cata_tiles::draw_field_or_item( const tripoint &p, const lit_level ll, int
 
                 // draw the default sprite
                 if( !has_drawn ) {
-                    ret_draw_field = draw_from_id_string( fld.id().str(), TILE_CATEGORY::FIELD, empty_string,
-                                                          p, subtile, rotation, lit, nv, height_3d, intensity );
+                    ret_draw_field = draw_from_int_id( fld, TILE_CATEGORY::FIELD, p, subtile,
+                                                       rotation, lit, nv, height_3d, intensity );
                 }
 
             }
@@ -3596,8 +3713,8 @@ bool cata_tiles::draw_field_or_item( const tripoint &p, const lit_level ll, int
 
             //get field intensity
             int intensity = fld_overridden ? 0 : here.field_at( p ).displayed_intensity();
-            ret_draw_field = draw_from_id_string( fld.id().str(), TILE_CATEGORY::FIELD, empty_string,
-                                                  p, subtile, rotation, lit, nv, height_3d, intensity );
+            ret_draw_field = draw_from_int_id( fld, TILE_CATEGORY::FIELD, p, subtile, rotation, lit,
+                                               nv, height_3d, intensity );
         }
     }
 
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_CATA_TILES_H
 #define CATA_SRC_CATA_TILES_H
 
+#include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
@@ -12,6 +13,7 @@
 #include <vector>
 
 #include "animation.h"
+#include "calendar.h"
 #include "cata_type_traits.h"
 #include "creature.h"
 #include "cuboid_rectangle.h"
@@ -25,6 +27,7 @@
 #include "point.h"
 #include "sdl_wrappers.h"
 #include "sdl_geometry.h"
+#include "sdl_utils.h"
 #include "type_id.h"
 #include "weather.h"
 #include "weighted_list.h"
@@ -150,12 +153,30 @@ class layer_variant
 
 class tileset
 {
+    public:
+        /** Color filtered variants of the sprites, used for different lighting conditions. */
+        enum class color_filter : int {
+            shadow,
+            night,
+            overexposed,
+            memory,
+            last
+        };
+
     private:
         struct season_tile_value {
             tile_type *default_tile = nullptr;
             std::optional<tile_lookup_res> season_tile = std::nullopt;
         };
 
+        // A part of a tile atlas that has been put into a single texture.
+        struct atlas_page {
+            // 32 bit copy of the page, source of its color filtered textures
+            SDL_Surface_Ptr surface;
+            // Index of each sprite of the page in tile_values and its place in the page
+            std::vector<std::pair<size_t, SDL_Rect>> sprites;
+        };
+
         std::string tileset_id;
 
         bool tile_isometric = false;
@@ -174,10 +195,15 @@ class tileset
         float tile_pixelscale = 1.0f;
 
         std::vector<texture> tile_values;
-        std::vector<texture> shadow_tile_values;
-        std::vector<texture> night_tile_values;
-        std::vector<texture> overexposed_tile_values;
-        std::vector<texture> memory_tile_values;
+        std::vector<atlas_page> atlas_pages;
+        // Index into atlas_pages for each entry of tile_values, -1 if it has no page.
+        std::vector<int> tile_pages;
+        std::array<color_pixel_function_pointer, static_cast<size_t>( color_filter::last )>
+        color_filter_functions = {};
+        // The filtered textures of a page are only created when one of its sprites is
+        // first drawn with that filter, most sessions never need most of them.
+        mutable std::array<std::vector<texture>, static_cast<size_t>( color_filter::last )>
+        filtered_tile_values;
 
         std::unordered_set<std::string> duplicate_ids;
 
@@ -188,7 +214,7 @@ class tileset
         tile_ids_by_season;
 
         static const texture *get_if_available( const size_t index,
-                                                const decltype( shadow_tile_values ) &tiles ) {
+                                                const decltype( tile_values ) &tiles ) {
             return index < tiles.size() ? & tiles[index] : nullptr;
         }
 
@@ -232,18 +258,13 @@ class tileset
         const texture *get_tile( const size_t index ) const {
             return get_if_available( index, tile_values );
         }
-        const texture *get_night_tile( const size_t index ) const {
-            return get_if_available( index, night_tile_values );
-        }
-        const texture *get_shadow_tile( const size_t index ) const {
-            return get_if_available( index, shadow_tile_values );
-        }
-        const texture *get_overexposed_tile( const size_t index ) const {
-            return get_if_available( index, overexposed_tile_values );
-        }
-        const texture *get_memory_tile( const size_t index ) const {
-            return get_if_available( index, memory_tile_values );
-        }
+        /**
+         * Returns the sprite with the given color filter applied, creating the filtered
+         * texture of its atlas page on first use. Returns nullptr if there is no filtered
+         * variant of the sprite.
+         */
+        const texture *get_filtered_tile( color_filter filter, size_t index,
+                                          const SDL_Renderer_Ptr &renderer ) const;
 
         const std::unordered_set<std::string> &get_duplicate_ids() const {
             return duplicate_ids;
@@ -307,8 +328,8 @@ class tileset_cache::loader
 
         void ensure_default_item_highlight();
 
-        void copy_surface_to_texture( const SDL_Surface_Ptr &surf, const point &offset,
-                                      std::vector<texture> &target );
+        std::vector<std::pair<size_t, SDL_Rect>> copy_surface_to_texture(
+            const SDL_Surface_Ptr &surf, const point &offset, std::vector<texture> &target );
         void create_textures_from_tile_atlas( const SDL_Surface_Ptr &tile_atlas, const point &offset );
 
         void process_variations_after_loading( weighted_int_list<std::vector<int>> &v ) const;
@@ -457,6 +478,18 @@ class cata_tiles
         std::optional<tile_lookup_res>
         find_tile_looks_like( const std::string &id, TILE_CATEGORY category, const std::string &variant,
                               int looks_like_jumps_limit = 10 ) const;
+        /**
+         * Same as find_tile_looks_like() with the default jump limit, but remembers the results.
+         * @param id_index The int_id of @p id if it has one, or -1. Ids with an int_id are
+         * remembered in a table indexed by it, so looking them up again doesn't hash any string.
+         * @param form 0 to look up @p id itself, -1 for id + "_transparent" and n > 0 for
+         * id + "_int" + n. Those strings are only built when the result isn't known yet.
+         */
+        std::optional<tile_lookup_res>
+        find_tile_looks_like_cached( const std::string &id, TILE_CATEGORY category,
+                                     const std::string &variant, int id_index, int form );
+        /** Clears the remembered tile lookups if the tileset or the season changed. */
+        void validate_tile_lookup_cache();
 
         // this templated method is used only from it's own cpp file, so it's ok to declare it here
         template<typename T>
@@ -496,7 +529,13 @@ class cata_tiles
         bool draw_from_id_string_internal( const std::string &id, TILE_CATEGORY category,
                                            const std::string &subcategory, const tripoint &pos, int subtile, int rota,
                                            lit_level ll, int retract, bool apply_night_vision_goggles, int &height_3d, int intensity_level,
-                                           const std::string &variant, const point &offset );
+                                           const std::string &variant, const point &offset,
+                                           int id_index = -1 );
+        /** Same as draw_from_id_string(), but the tile of @p id is looked up by the int_id */
+        template<typename T>
+        bool draw_from_int_id( const int_id<T> &id, TILE_CATEGORY category, const tripoint &pos,
+                               int subtile, int rota, lit_level ll, bool apply_night_vision_goggles,
+                               int &height_3d, int intensity_level = 0 );
         bool draw_sprite_at(
             const tile_type &tile, const weighted_int_list<std::vector<int>> &svlist,
             const point &, unsigned int loc_rand, bool rota_fg, int rota, lit_level ll,
@@ -682,6 +721,11 @@ class cata_tiles
          * @throw std::exception On any error.
          */
         void reinit();
+        /**
+         * Forgets which tiles ids resolved to, must be called when the game data they may
+         * fall back on through looks_like changes.
+         */
+        void clear_tile_lookup_cache();
 
         bool is_isometric() const {
             return tileset_ptr->is_isometric();
@@ -736,6 +780,26 @@ class cata_tiles
         tileset_cache &cache;
         std::shared_ptr<const tileset> tileset_ptr;
 
+        // Results of find_tile_looks_like_cached(), for tile_lookup_tileset in tile_lookup_season.
+        // Resolving an id can take several lookups with freshly built strings and looks_like
+        // jumps, and the same ids are drawn every frame.
+        struct resolved_tile {
+            bool resolved = false;
+            std::optional<tile_lookup_res> tile;
+        };
+        // By category, int_id and form + 1 (see find_tile_looks_like_cached)
+        using tile_lookup_table_t = std::vector<std::vector<resolved_tile>>;
+        std::array<tile_lookup_table_t, static_cast<size_t>( TILE_CATEGORY::last )>
+        tile_lookup_table;
+        // By category, id and variant, for the ids drawn without an int_id
+        using tile_lookup_cache_t = std::unordered_map<std::string,
+              std::unordered_map<std::string, std::optional<tile_lookup_res>>>;
+        std::array<tile_lookup_cache_t, static_cast<size_t>( TILE_CATEGORY::last )> tile_lookup_cache;
+        const tileset *tile_lookup_tileset = nullptr;
+        season_type tile_lookup_season = season_type::NUM_SEASONS;
+        // The turn the season was last checked in, it only needs to be checked once per turn
+        time_point tile_lookup_turn = calendar::before_time_starts;
+
         // the scaled default sprite width and height. in non-isometric mode,
         // the basic tile width and height equal the default sprite width and
         // height, but in isometric mode, the basic tile height is always
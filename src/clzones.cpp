@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstdint>
 #include <functional>
 #include <iosfwd>
 #include <iterator>
@@ -859,14 +860,7 @@ void zone_manager::cache_data( bool update_avatar )
             elem.update_cached_shift( cached_shift );
         }
 
-        const std::string &type_hash = elem.get_type_hash();
-        auto &cache = area_cache[type_hash];
-
-        // Draw marked area
-        for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
-                 elem.get_start_point(), elem.get_end_point() ) ) {
-            cache.insert( p );
-        }
+        area_cache[elem.get_type_hash()].emplace_back( elem.get_start_point(), elem.get_end_point() );
     }
 }
 
@@ -908,25 +902,54 @@ void zone_manager::cache_vzones( map *pmap )
             continue;
         }
 
-        const std::string &type_hash = elem->get_type_hash();
-        auto &cache = vzone_cache[type_hash];
+        vzone_cache[elem->get_type_hash()].emplace_back( elem->get_start_point(), elem->get_end_point() );
+    }
+}
 
-        // TODO: looks very similar to the above cache_data - maybe merge it?
+// whether any point of the area is within range of where, optionally only on the z-level of where
+static bool area_is_near( const inclusive_cuboid<tripoint_abs_ms> &area,
+                          const tripoint_abs_ms &where, int range, bool same_z_only )
+{
+    if( same_z_only && ( where.z() < area.p_min.z() || where.z() > area.p_max.z() ) ) {
+        return false;
+    }
+    return square_dist( clamp( where, area ), where ) <= range;
+}
 
-        // Draw marked area
-        for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
-                 elem->get_start_point(), elem->get_end_point() ) ) {
-            cache.insert( p );
-        }
+// calls func for each point of the area within range of where, optionally only on the z-level of where
+template<typename Func>
+static void for_each_point_near( const inclusive_cuboid<tripoint_abs_ms> &area,
+                                 const tripoint_abs_ms &where, int range, bool same_z_only, Func func )
+{
+    // 64 bit so that huge ranges don't overflow
+    const auto lower = []( int area_min, int center, int r ) {
+        return static_cast<int>( std::max<int64_t>( area_min, int64_t( center ) - r ) );
+    };
+    const auto upper = []( int area_max, int center, int r ) {
+        return static_cast<int>( std::min<int64_t>( area_max, int64_t( center ) + r ) );
+    };
+    const int z_range = same_z_only ? 0 : range;
+    const tripoint_abs_ms lo( lower( area.p_min.x(), where.x(), range ),
+                              lower( area.p_min.y(), where.y(), range ),
+                              lower( area.p_min.z(), where.z(), z_range ) );
+    const tripoint_abs_ms hi( upper( area.p_max.x(), where.x(), range ),
+                              upper( area.p_max.y(), where.y(), range ),
+                              upper( area.p_max.z(), where.z(), z_range ) );
+    if( lo.x() > hi.x() || lo.y() > hi.y() || lo.z() > hi.z() ) {
+        return;
+    }
+    for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>( lo, hi ) ) {
+        func( p );
     }
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_point_set( const zone_type_id &type,
+const zone_manager::zone_areas &zone_manager::get_areas( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const zone_areas no_areas;
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return no_areas;
     }
 
     return type_iter->second;
@@ -943,35 +966,31 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
 {
     std::unordered_set<tripoint> res;
     map &here = get_map();
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : area_cache ) {
-        zone_type_id type = zone_data::unhash_type( cache.first );
-        faction_id z_fac = zone_data::unhash_fac( cache.first );
-        if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
-            for( tripoint_abs_ms point : cache.second ) {
-                if( square_dist( where, point ) <= radius ) {
-                    res.emplace( here.getlocal( point ) );
-                }
+    const auto add_loot_points = [&]( const std::unordered_map<std::string, zone_areas> &cache ) {
+        for( const std::pair<const std::string, zone_areas> &type_areas : cache ) {
+            zone_type_id type = zone_data::unhash_type( type_areas.first );
+            faction_id z_fac = zone_data::unhash_fac( type_areas.first );
+            if( fac != z_fac || type.str().substr( 0, 4 ) != "LOOT" ) {
+                continue;
             }
-        }
-    }
-    for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
-        zone_type_id type = zone_data::unhash_type( cache.first );
-        faction_id z_fac = zone_data::unhash_fac( cache.first );
-        if( fac == z_fac && type.str().substr( 0, 4 ) == "LOOT" ) {
-            for( tripoint_abs_ms point : cache.second ) {
-                if( square_dist( where, point ) <= radius ) {
-                    res.emplace( here.getlocal( point ) );
-                }
+            for( const inclusive_cuboid<tripoint_abs_ms> &area : type_areas.second ) {
+                for_each_point_near( area, where, radius, false, [&]( const tripoint_abs_ms & p ) {
+                    res.emplace( here.getlocal( p ) );
+                } );
             }
         }
-    }
+    };
+    add_loot_points( area_cache );
+    add_loot_points( vzone_cache );
 
     if( npc_search ) {
-        for( const std::pair<std::string, std::unordered_set<tripoint_abs_ms>> cache : vzone_cache ) {
-            zone_type_id type = zone_data::unhash_type( cache.first );
+        for( const std::pair<const std::string, zone_areas> &type_areas : vzone_cache ) {
+            zone_type_id type = zone_data::unhash_type( type_areas.first );
             if( type == zone_type_NO_NPC_PICKUP ) {
-                for( tripoint_abs_ms point : cache.second ) {
-                    res.erase( here.getlocal( point ) );
+                for( const inclusive_cuboid<tripoint_abs_ms> &area : type_areas.second ) {
+                    for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>( area.p_min, area.p_max ) ) {
+                        res.erase( here.getlocal( p ) );
+                    }
                 }
             }
         }
@@ -980,13 +999,14 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint_ab
     return res;
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_vzone_set( const zone_type_id &type,
+const zone_manager::zone_areas &zone_manager::get_vzone_areas( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const zone_areas no_areas;
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+        return no_areas;
     }
 
     return type_iter->second;
@@ -995,27 +1015,27 @@ std::unordered_set<tripoint_abs_ms> zone_manager::get_vzone_set( const zone_type
 bool zone_manager::has( const zone_type_id &type, const tripoint_abs_ms &where,
                         const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    const auto &vzone_set = get_vzone_set( type, fac );
-    return point_set.find( where ) != point_set.end() || vzone_set.find( where ) != vzone_set.end();
+    const auto contains_where = [&where]( const inclusive_cuboid<tripoint_abs_ms> &area ) {
+        return area.contains( where );
+    };
+    const zone_areas &areas = get_areas( type, fac );
+    const zone_areas &vzone_areas = get_vzone_areas( type, fac );
+    return std::any_of( areas.begin(), areas.end(), contains_where ) ||
+           std::any_of( vzone_areas.begin(), vzone_areas.end(), contains_where );
 }
 
 bool zone_manager::has_near( const zone_type_id &type, const tripoint_abs_ms &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
+    for( const inclusive_cuboid<tripoint_abs_ms> &area : get_areas( type, fac ) ) {
+        if( area_is_near( area, where, range, false ) ) {
             return true;
         }
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
-            }
+    for( const inclusive_cuboid<tripoint_abs_ms> &area : get_vzone_areas( type, fac ) ) {
+        if( area_is_near( area, where, range, true ) ) {
+            return true;
         }
     }
 
@@ -1093,6 +1113,24 @@ std::vector<zone_data const *> zone_manager::get_zones_at( const tripoint_abs_ms
     return ret;
 }
 
+// whether a LOOT_CUSTOM or LOOT_ITEM_GROUP zone accepts the item
+static bool custom_loot_zone_accepts( const zone_data &zone, const item &it )
+{
+    item const *const check_it = it.this_or_single_content();
+    loot_options const &options = dynamic_cast<const loot_options &>( zone.get_options() );
+    std::string const filter_string = options.get_mark();
+    if( zone.get_type() == zone_type_LOOT_CUSTOM ) {
+        auto const z = item_filter_from_string( filter_string );
+        return z( *check_it ) || ( check_it != &it && z( it ) );
+    } else if( zone.get_type() == zone_type_LOOT_ITEM_GROUP ) {
+        return item_group::group_contains_item( item_group_id( filter_string ),
+                                                check_it->typeId() ) ||
+               ( check_it != &it &&
+                 item_group::group_contains_item( item_group_id( filter_string ), it.typeId() ) );
+    }
+    return false;
+}
+
 bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it,
                                     const zone_type_id &ztype, const faction_id &fac ) const
 {
@@ -1100,22 +1138,8 @@ bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it
     if( zones.empty() || !it ) {
         return false;
     }
-    item const *const check_it = it->this_or_single_content();
     for( zone_data const *zone : zones ) {
-        loot_options const &options = dynamic_cast<const loot_options &>( zone->get_options() );
-        std::string const filter_string = options.get_mark();
-        bool has = false;
-        if( ztype == zone_type_LOOT_CUSTOM ) {
-            auto const z = item_filter_from_string( filter_string );
-            has = z( *check_it ) || ( check_it != it && z( *it ) );
-        } else if( ztype == zone_type_LOOT_ITEM_GROUP ) {
-            has = item_group::group_contains_item( item_group_id( filter_string ),
-                                                   check_it->typeId() ) ||
-                  ( check_it != it &&
-                    item_group::group_contains_item( item_group_id( filter_string ),
-                            it->typeId() ) );
-        }
-        if( has ) {
+        if( custom_loot_zone_accepts( *zone, *it ) ) {
             return true;
         }
     }
@@ -1126,28 +1150,52 @@ bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it
 std::unordered_set<tripoint_abs_ms> zone_manager::get_near( const zone_type_id &type,
         const tripoint_abs_ms &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
+    if( type == zone_type_LOOT_CUSTOM || type == zone_type_LOOT_ITEM_GROUP ) {
+        return get_near_custom_loot( type, where, range, it, fac );
+    }
+
     std::unordered_set<tripoint_abs_ms> near_point_set;
+    const auto insert_point = [&near_point_set]( const tripoint_abs_ms & p ) {
+        near_point_set.insert( p );
+    };
 
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
-            if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                near_point_set.insert( point );
-            }
-        }
+    for( const inclusive_cuboid<tripoint_abs_ms> &area : get_areas( type, fac ) ) {
+        for_each_point_near( area, where, range, false, insert_point );
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                    ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                    near_point_set.insert( point );
-                }
-            }
+    for( const inclusive_cuboid<tripoint_abs_ms> &area : get_vzone_areas( type, fac ) ) {
+        for_each_point_near( area, where, range, true, insert_point );
+    }
+
+    return near_point_set;
+}
+
+std::unordered_set<tripoint_abs_ms> zone_manager::get_near_custom_loot( const zone_type_id &type,
+        const tripoint_abs_ms &where, int range, const item *it, const faction_id &fac ) const
+{
+    std::unordered_set<tripoint_abs_ms> near_point_set;
+    if( it == nullptr ) {
+        return near_point_set;
+    }
+
+    // Evaluate the filter once per zone rather than once per point of every zone.
+    const auto add_points = [&]( const zone_data & zone, bool same_z_only ) {
+        if( !zone.get_enabled() || zone.get_type() != type || zone.get_faction() != fac ||
+            !custom_loot_zone_accepts( zone, *it ) ) {
+            return;
         }
+        for_each_point_near( inclusive_cuboid<tripoint_abs_ms>( zone.get_start_point(),
+        zone.get_end_point() ), where, range, same_z_only, [&]( const tripoint_abs_ms & p ) {
+            near_point_set.insert( p );
+        } );
+    };
+
+    for( const zone_data &zone : zones ) {
+        add_points( zone, false );
+    }
+    map &here = get_map();
+    for( const zone_data *zone : here.get_vehicle_zones( here.get_abs_sub().z() ) ) {
+        add_points( *zone, true );
     }
 
     return near_point_set;
@@ -1162,26 +1210,18 @@ std::optional<tripoint_abs_ms> zone_manager::get_nearest( const zone_type_id &ty
 
     tripoint_abs_ms nearest_pos( INT_MIN, INT_MIN, INT_MIN );
     int nearest_dist = range + 1;
-    const std::unordered_set<tripoint_abs_ms> &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &p : point_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
-            }
-        }
-    }
-
-    const std::unordered_set<tripoint_abs_ms> &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &p : vzone_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
+    for( const zone_areas *areas : {
+             &get_areas( type, fac ), &get_vzone_areas( type, fac )
+         } ) {
+        for( const inclusive_cuboid<tripoint_abs_ms> &area : *areas ) {
+            const tripoint_abs_ms p = clamp( where, area );
+            int cur_dist = square_dist( p, where );
+            if( cur_dist < nearest_dist ) {
+                nearest_dist = cur_dist;
+                nearest_pos = p;
+                if( nearest_dist == 0 ) {
+                    return nearest_pos;
+                }
             }
         }
     }
@@ -15,6 +15,7 @@
 #include <utility>
 #include <vector>
 
+#include "cuboid_rectangle.h"
 #include "memory_fast.h"
 #include "point.h"
 #include "translations.h"
@@ -532,14 +533,20 @@ class zone_manager
         // a count of the number of personal zones the character has
         int num_personal_zones = 0; // NOLINT(cata-serialize)
 
+        // Areas covered by enabled zones, keyed by zone_data::get_type_hash().
+        // Zones are kept as the cuboids they are defined by, so queries only need to
+        // look at the parts of each zone that are in range instead of every point.
+        using zone_areas = std::vector<inclusive_cuboid<tripoint_abs_ms>>;
         // NOLINTNEXTLINE(cata-serialize)
-        std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> area_cache;
+        std::unordered_map<std::string, zone_areas> area_cache;
         // NOLINTNEXTLINE(cata-serialize)
-        std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> vzone_cache;
-        std::unordered_set<tripoint_abs_ms> get_point_set( const zone_type_id &type,
-                const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint_abs_ms> get_vzone_set( const zone_type_id &type,
-                const faction_id &fac = your_fac ) const;
+        std::unordered_map<std::string, zone_areas> vzone_cache;
+        const zone_areas &get_areas( const zone_type_id &type, const faction_id &fac = your_fac ) const;
+        const zone_areas &get_vzone_areas( const zone_type_id &type,
+                                           const faction_id &fac = your_fac ) const;
+        // get_near() for LOOT_CUSTOM and LOOT_ITEM_GROUP, which only includes zones accepting the item
+        std::unordered_set<tripoint_abs_ms> get_near_custom_loot( const zone_type_id &type,
+                const tripoint_abs_ms &where, int range, const item *it, const faction_id &fac ) const;
     public:
         zone_manager();
         ~zone_manager() = default;
@@ -628,7 +628,7 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
             if( !it->is_watertight_container() || it->get_quality( qual_BOIL, false ) <= 0 ) {
                 item tmp = item( it->typeId(), it->birthday() );
                 tmp.is_favorite = it->is_favorite;
-                *crafting_cache.crafting_inventory += tmp;
+                crafting_cache.crafting_inventory->add_item( std::move( tmp ) );
             }
             continue;
         } else if( it->is_watertight_container() ) {
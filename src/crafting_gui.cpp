@@ -188,19 +188,21 @@ struct availability {
                                         || crafter.get_knowledge_level( rec->skill_used )
                                         >= static_cast<int>( rec->get_difficulty( crafter ) * 0.8f );
             has_proficiencies = r->character_has_required_proficiencies( crafter );
+            const bool has_all_items = req.can_make_with_inventory( inv, all_items_filter, batch_size,
+                                       craft_flags::start_only );
             std::string reason;
             if( crafter.is_npc() && !r->npc_can_craft( reason ) ) {
                 can_craft = false;
             } else if( r->is_nested() ) {
                 can_craft = check_can_craft_nested( _crafter, *r );
             } else {
-                can_craft = ( !r->is_practice() || has_all_skills ) && has_proficiencies &&
-                            req.can_make_with_inventory( inv, all_items_filter, batch_size, craft_flags::start_only );
+                can_craft = ( !r->is_practice() || has_all_skills ) && has_proficiencies && has_all_items;
             }
-            would_use_rotten = !req.can_make_with_inventory( inv, no_rotten_filter, batch_size,
-                               craft_flags::start_only );
-            would_use_favorite = !req.can_make_with_inventory( inv, no_favorite_filter, batch_size,
-                                 craft_flags::start_only );
+            // The other filters only exclude more items, so they can't succeed where all items don't.
+            would_use_rotten = !has_all_items ||
+                               !req.can_make_with_inventory( inv, no_rotten_filter, batch_size, craft_flags::start_only );
+            would_use_favorite = !has_all_items ||
+                                 !req.can_make_with_inventory( inv, no_favorite_filter, batch_size, craft_flags::start_only );
             useless_practice = r->is_practice() && cannot_gain_skill_or_prof( crafter, *r );
             is_nested_category = r->is_nested();
             const requirement_data &simple_req = r->simple_requirements();
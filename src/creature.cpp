@@ -484,17 +484,23 @@ bool Creature::sees( const tripoint &t, bool is_avatar, int range_mod ) const
     }
 
     map &here = get_map();
-    const int range_cur = sight_range( here.ambient_light_at( t ) );
+    const int wanted_range = rl_dist( pos(), t );
+    const float light_at_target = here.ambient_light_at( t );
+    // Lit by something other than the sun, so visible from further away
+    const bool artificially_lit = light_at_target >
+                                  here.get_cache_ref( t.z ).natural_light_level_cache;
+    const int range_cur = sight_range( light_at_target );
+    if( wanted_range > range_cur && !artificially_lit ) {
+        // Out of range either way, no need to look at day and night ranges
+        return false;
+    }
     const int range_day = sight_range( default_daylight_level() );
     const int range_night = sight_range( 0 );
     const int range_max = std::max( range_day, range_night );
     const int range_min = std::min( range_cur, range_max );
-    const int wanted_range = rl_dist( pos(), t );
-    if( wanted_range <= range_min ||
-        ( wanted_range <= range_max &&
-          here.ambient_light_at( t ) > here.get_cache_ref( t.z ).natural_light_level_cache ) ) {
+    if( wanted_range <= range_min || ( wanted_range <= range_max && artificially_lit ) ) {
         int range = 0;
-        if( here.ambient_light_at( t ) > here.get_cache_ref( t.z ).natural_light_level_cache ) {
+        if( artificially_lit ) {
             range = MAX_VIEW_DISTANCE;
         } else {
             range = range_min;
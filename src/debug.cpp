@@ -108,6 +108,8 @@ static bool error_observed = false;
 static bool capturing = false;
 /** сaptured debug messages */
 static std::string captured;
+/** If set, debug messages on this thread are deferred into it, see defer_debugmsgs_during */
+static thread_local std::vector<deferred_debugmsg> *deferred_debugmsgs = nullptr;
 
 #if defined(_WIN32) and defined(LIBBACKTRACE)
 // Get the image base of a module from its PE header
@@ -202,6 +204,24 @@ capture_debugmsg::~capture_debugmsg()
     capturing = false;
 }
 
+std::vector<deferred_debugmsg> defer_debugmsgs_during( const std::function<void()> &func )
+{
+    std::vector<deferred_debugmsg> deferred;
+    deferred_debugmsgs = &deferred;
+    on_out_of_scope stop_deferring( []() {
+        deferred_debugmsgs = nullptr;
+    } );
+    func();
+    return deferred;
+}
+
+void replay_deferred_debugmsgs( const std::vector<deferred_debugmsg> &msgs )
+{
+    for( const deferred_debugmsg &msg : msgs ) {
+        realDebugmsg( msg.filename.c_str(), msg.line.c_str(), msg.funcname.c_str(), msg.text );
+    }
+}
+
 bool debug_has_error_been_observed()
 {
     return error_observed;
@@ -507,6 +527,11 @@ void realDebugmsg( const char *filename, const char *line, const char *funcname,
     cata_assert( line != nullptr );
     cata_assert( funcname != nullptr );
 
+    if( deferred_debugmsgs ) {
+        deferred_debugmsgs->push_back( { filename, line, funcname, text } );
+        return;
+    }
+
     if( capturing ) {
         captured += text;
     } else {
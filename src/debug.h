@@ -46,6 +46,8 @@
  */
 
 #include <functional>
+#include <string>
+#include <vector>
 // Includes                                                         {{{1
 // ---------------------------------------------------------------------
 #include <iostream>
@@ -212,6 +214,25 @@ bool debug_has_error_been_observed();
  */
 std::string capture_debugmsg_during( const std::function<void()> &func );
 
+/** A debugmsg call deferred by defer_debugmsgs_during. */
+struct deferred_debugmsg {
+    std::string filename;
+    std::string line;
+    std::string funcname;
+    std::string text;
+};
+
+/**
+ * Calls func and returns the debugmsg calls it made instead of reporting them.
+ * Unlike capture_debugmsg_during, this only affects the calling thread, so several
+ * threads can defer their messages at the same time.
+ * Report them later with replay_deferred_debugmsgs.
+ */
+std::vector<deferred_debugmsg> defer_debugmsgs_during( const std::function<void()> &func );
+
+/** Reports debugmsg calls deferred by defer_debugmsgs_during as if they were made now. */
+void replay_deferred_debugmsgs( const std::vector<deferred_debugmsg> &msgs );
+
 /**
  * Should be called after catacurses::stdscr is initialized.
  * If catacurses::stdscr is available, shows all buffered debugmsg prompts.
@@ -101,6 +101,7 @@
 #include "trait_group.h"
 #include "translations.h"
 #include "try_parse_integer.h"
+#include "turn_profiler.h"
 #include "type_id.h"
 #include "ui.h"
 #include "ui_manager.h"
@@ -228,6 +229,7 @@ std::string enum_to_string<debug_menu::debug_menu_index>( debug_menu::debug_menu
         case debug_menu::debug_menu_index::DISPLAY_TRANSPARENCY: return "DISPLAY_TRANSPARENCY";
         case debug_menu::debug_menu_index::DISPLAY_RADIATION: return "DISPLAY_RADIATION";
         case debug_menu::debug_menu_index::HOUR_TIMER: return "HOUR_TIMER";
+        case debug_menu::debug_menu_index::TURN_PROFILER: return "TURN_PROFILER";
         case debug_menu::debug_menu_index::CHANGE_SPELLS: return "CHANGE_SPELLS";
         case debug_menu::debug_menu_index::TEST_MAP_EXTRA_DISTRIBUTION: return "TEST_MAP_EXTRA_DISTRIBUTION";
         case debug_menu::debug_menu_index::NESTED_MAPGEN: return "NESTED_MAPGEN";
@@ -479,6 +481,7 @@ static int info_uilist( bool display_all_entries = true )
             { uilist_entry( debug_menu_index::SHOW_MUT_CAT, true, 'm', _( "Show mutation category levels" ) ) },
             { uilist_entry( debug_menu_index::BENCHMARK, true, 'b', _( "Draw benchmark (X seconds)" ) ) },
             { uilist_entry( debug_menu_index::HOUR_TIMER, true, 'E', _( "Toggle hour timer" ) ) },
+            { uilist_entry( debug_menu_index::TURN_PROFILER, true, 'P', _( "Toggle turn profiler" ) ) },
             { uilist_entry( debug_menu_index::TRAIT_GROUP, true, 't', _( "Test trait group" ) ) },
             { uilist_entry( debug_menu_index::DISPLAY_NPC_PATH, true, 'n', _( "Toggle NPC pathfinding on map" ) ) },
             { uilist_entry( debug_menu_index::DISPLAY_NPC_ATTACK, true, 'A', _( "Toggle NPC attack potential values on map" ) ) },
@@ -2608,6 +2611,35 @@ static void draw_benchmark( const int max_difference )
              difference / 1000.0, 1000.0 * draw_counter / static_cast<double>( difference ) );
 }
 
+static void toggle_turn_profiler()
+{
+    if( !turn_profiler::is_compiled_in() ) {
+        popup( _( "The turn profiler is not compiled in, build with PROFILER=1 to use it." ) );
+        return;
+    }
+    if( !turn_profiler::is_running() ) {
+        turn_profiler::start();
+        add_msg( m_info, _( "Turn profiler started." ) );
+        return;
+    }
+    turn_profiler::stop();
+
+    using ms = std::chrono::duration<double, std::milli>;
+    const int turns = turn_profiler::recorded_turns();
+    std::string s = string_format( _( "Profiled %d turns.\n\n" ), turns );
+    for( const turn_profiler::zone_stats &stats : turn_profiler::get_stats() ) {
+        s += string_format( _( "%s%s: %.3f ms per turn, %.3f ms at most, %d calls\n" ),
+                            std::string( 2 * stats.depth, ' ' ), stats.name,
+                            ms( stats.total ).count() / std::max( turns, 1 ),
+                            ms( stats.max_per_turn ).count(), stats.count );
+    }
+    if( turn_profiler::write_trace( "turn_profile.json" ) ) {
+        s += _( "\nTrace written to turn_profile.json" );
+    }
+    DebugLog( D_INFO, DC_ALL ) << s;
+    popup( s );
+}
+
 static void debug_menu_game_state()
 {
     avatar &player_character = get_avatar();
@@ -2848,6 +2880,7 @@ void debug()
         debug_menu_index::ENABLE_ACHIEVEMENTS,
         debug_menu_index::UNLOCK_ALL,
         debug_menu_index::BENCHMARK,
+        debug_menu_index::TURN_PROFILER,
         debug_menu_index::SHOW_MSG,
         debug_menu_index::QUICKLOAD,
         debug_menu_index::QUIT_NOSAVE,
@@ -3291,6 +3324,9 @@ void debug()
         case debug_menu_index::HOUR_TIMER:
             g->toggle_debug_hour_timer();
             break;
+        case debug_menu_index::TURN_PROFILER:
+            toggle_turn_profiler();
+            break;
         case debug_menu_index::CHANGE_TIME:
             calendar::turn = calendar_ui::select_time_point( calendar::turn );
             break;
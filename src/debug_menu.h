@@ -83,6 +83,7 @@ enum class debug_menu_index : int {
     DISPLAY_TRANSPARENCY,
     DISPLAY_RADIATION,
     HOUR_TIMER,
+    TURN_PROFILER,
     CHANGE_SPELLS,
     TEST_MAP_EXTRA_DISTRIBUTION,
     NESTED_MAPGEN,
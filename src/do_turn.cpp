@@ -33,6 +33,7 @@
 #include "sdlsound.h"
 #include "stats_tracker.h"
 #include "timed_event.h"
+#include "turn_profiler.h"
 #include "ui_manager.h"
 #include "vehicle.h"
 #include "vpart_position.h"
@@ -225,6 +226,7 @@ namespace
 {
 void monmove()
 {
+    CATA_PROFILE_ZONE( "monmove" );
     g->cleanup_dead();
     map &m = get_map();
     avatar &u = get_avatar();
@@ -396,6 +398,52 @@ void overmap_npc_move()
     }
 }
 
+// Generates one missing overmap terrain just past the edge of the reality bubble, in the
+// direction the player moved this turn. Shifting the map onto it later only has to load
+// it, so the cost of mapgen is spread over turns instead of stalling a single one.
+void pregenerate_map_ahead()
+{
+    CATA_PROFILE_ZONE( "pregenerate_map_ahead" );
+    static tripoint_abs_ms last_pos;
+    const tripoint_abs_ms pos = get_avatar().get_location();
+    const point delta = ( pos - last_pos ).raw().xy();
+    last_pos = pos;
+    // Standing still, or teleported (which includes loading a game)
+    if( delta == point_zero || std::abs( delta.x ) > HALF_MAPSIZE_X ||
+        std::abs( delta.y ) > HALF_MAPSIZE_Y ) {
+        return;
+    }
+    const point dir( ( delta.x > 0 ) - ( delta.x < 0 ), ( delta.y > 0 ) - ( delta.y < 0 ) );
+
+    const tripoint_abs_sm bubble_origin = get_map().get_abs_sub();
+    const point_abs_omt bubble_min = project_to<coords::omt>( bubble_origin.xy() );
+    const point_abs_omt bubble_max = project_to<coords::omt>( bubble_origin.xy() +
+                                     point( MAPSIZE - 1, MAPSIZE - 1 ) );
+    const inclusive_rectangle<point_abs_omt> bubble( bubble_min, bubble_max );
+    // The bubble shifts one submap at a time, so two overmap terrains is plenty of warning
+    constexpr int lookahead = 2;
+    for( int step = 1; step <= lookahead; step++ ) {
+        for( int x = bubble_min.x(); x <= bubble_max.x(); x++ ) {
+            for( int y = bubble_min.y(); y <= bubble_max.y(); y++ ) {
+                const point_abs_omt p = point_abs_omt( x, y ) + dir * step;
+                const tripoint_abs_omt on_player_level( p, pos.z() );
+                if( bubble.contains( p ) ||
+                    MAPBUFFER.lookup_submap( project_to<coords::sm>( on_player_level ) ) ) {
+                    continue;
+                }
+                for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+                    const tripoint_abs_omt omt( p, z );
+                    if( !MAPBUFFER.lookup_submap( project_to<coords::sm>( omt ) ) ) {
+                        generate_omt( omt, calendar::turn );
+                    }
+                }
+                // At most one per turn, so no single turn takes much longer than the others
+                return;
+            }
+        }
+    }
+}
+
 } // namespace
 
 // MAIN GAME LOOP
@@ -419,7 +467,10 @@ bool do_turn()
             weather.set_nextweather( calendar::turn );
         }
     } else {
-        g->gamemode->per_turn();
+        // No game mode is set up when turns are run outside a started game (e.g. in tests)
+        if( g->gamemode ) {
+            g->gamemode->per_turn();
+        }
         calendar::turn += 1_turns;
     }
 
@@ -688,6 +739,7 @@ bool do_turn()
         g->first_redraw_since_waiting_started = true;
     }
 
+    pregenerate_map_ahead();
     m.invalidate_visibility_cache();
 
     u.update_bodytemp();
@@ -721,6 +773,8 @@ bool do_turn()
     u.power_balance = u.get_power_level() - u.power_prev_turn;
     u.power_prev_turn = u.get_power_level();
 
+    turn_profiler::end_turn();
+
 #if defined(EMSCRIPTEN)
     // This will cause a prompt to be shown if the window is closed, until the
     // game is saved.
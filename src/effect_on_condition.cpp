@@ -9,6 +9,7 @@
 #include "npctalk.h"
 #include "scenario.h"
 #include "talker.h"
+#include "turn_profiler.h"
 #include "type_id.h"
 
 namespace io
@@ -252,6 +253,7 @@ static void process_eocs( queued_eocs &eoc_queue, std::vector<effect_on_conditio
 
 void effect_on_conditions::process_effect_on_conditions( Character &you )
 {
+    CATA_PROFILE_ZONE( "effect_on_conditions::process_effect_on_conditions" );
     dialogue d( get_talker_for( you ), nullptr );
     process_eocs( you.queued_effect_on_conditions, you.inactive_effect_on_condition_vector, d );
     //only handle global eocs on the avatars turn
@@ -101,6 +101,10 @@ static float fragment_area = 0.00001f;
 static constexpr float MIN_EFFECTIVE_VELOCITY = 70.0f;
 // Pretty arbitrary minimum density.  1/100 chance of a fragment passing through the given square.
 static constexpr float MIN_FRAGMENT_DENSITY = 0.001f;
+// SWAG coefficient of drag.
+static constexpr float FRAGMENT_DRAG_COEFFICIENT = 1.5f;
+// Lowest drag of any square in the obstacle cache, see map::build_obstacle_cache().
+static constexpr float MIN_OBSTACLE_DRAG = 1.2f;
 
 explosion_data load_explosion_data( const JsonObject &jo )
 {
@@ -372,6 +376,25 @@ static void do_blast( const Creature *source, const tripoint &p, const float pow
     }
 }
 
+// Distance beyond which shrapnel_check() fails for any fragments cast from initial,
+// no matter what they pass through on the way.
+static int max_shrapnel_range( const fragment_cloud &initial )
+{
+    // Shadowcasting doesn't go further than this anyway.
+    constexpr int max_range = 60;
+    if( initial.velocity <= MIN_EFFECTIVE_VELOCITY || initial.density <= MIN_FRAGMENT_DENSITY ) {
+        return 1;
+    }
+    // Every square slows fragments down at least as much as open air does...
+    const float velocity_range = std::log( initial.velocity / MIN_EFFECTIVE_VELOCITY ) *
+                                 ( 2.0f * fragment_mass ) /
+                                 ( MIN_OBSTACLE_DRAG * FRAGMENT_DRAG_COEFFICIENT * fragment_area );
+    // ...and no square makes them denser, so density falls off at least with the square of distance.
+    const float density_range = std::sqrt( initial.density / MIN_FRAGMENT_DENSITY );
+    const float range = std::min( { velocity_range, density_range, static_cast<float>( max_range ) } );
+    return std::max( 1, static_cast<int>( std::ceil( range ) ) );
+}
+
 static std::vector<tripoint> shrapnel( const Creature *source, const tripoint &src, int power,
                                        int casing_mass, float per_fragment_mass, int range = -1 )
 {
@@ -399,12 +422,16 @@ static std::vector<tripoint> shrapnel( const Creature *source, const tripoint &s
     cata::mdarray<fragment_cloud, point_bub_ms> &visited_cache = caches->visited_cache;
 
     map &here = get_map();
-    // TODO: Calculate range based on max effective range for projectiles.
-    // Basically bisect between 0 and map diameter using shrapnel_calc().
-    // Need to update shadowcasting to support limiting range without adjusting initial distance.
-    const tripoint_range<tripoint> area = here.points_on_zlevel( src.z );
+    // Fragments can't be effective further away than this, so only the obstacles in range
+    // have to be known.  Squares that aren't cached are opaque, which only cuts the
+    // shadowcasting short where the fragments would have been stopped anyway.
+    const int max_range = max_shrapnel_range( { fragment_velocity, static_cast<float>( fragment_count ) } );
+    const tripoint_range<tripoint> area = here.points_in_rectangle(
+            tripoint( std::max( src.x - max_range, 0 ), std::max( src.y - max_range, 0 ), src.z ),
+            tripoint( std::min( src.x + max_range, MAPSIZE_X - 1 ), std::min( src.y + max_range,
+                      MAPSIZE_Y - 1 ), src.z ) );
 
-    here.build_obstacle_cache( area.min(), area.max() + tripoint_south_east, obstacle_cache );
+    here.build_obstacle_cache( area.min(), area.max(), obstacle_cache );
 
     // Shadowcasting normally ignores the origin square,
     // so apply it manually to catch monsters standing on the explosive.
@@ -937,8 +964,7 @@ fragment_cloud shrapnel_calc( const fragment_cloud &initial,
                               const fragment_cloud &cloud,
                               const int &distance )
 {
-    // SWAG coefficient of drag.
-    constexpr float Cd = 1.5f;
+    constexpr float Cd = FRAGMENT_DRAG_COEFFICIENT;
     fragment_cloud new_cloud;
     new_cloud.velocity = initial.velocity * std::exp( -cloud.velocity * ( (
                              Cd * fragment_area * distance ) /
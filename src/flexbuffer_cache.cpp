@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -124,6 +125,25 @@ std::vector<uint8_t> parse_json_to_flexbuffer_(
     return std::move( fbb ).GetBuffer();
 }
 
+// A snapshot file is laid out as:
+//   snapshot_magic, the key size and the file count as uint64_t, the key,
+//   the offset and size of each file's flexbuffer as uint64_t, the flexbuffers.
+// The key, the table and each flexbuffer start at a multiple of snapshot_alignment.
+constexpr char snapshot_magic[] = "FBSNAP1";
+constexpr size_t snapshot_alignment = 8;
+
+size_t align_snapshot_offset( size_t offset )
+{
+    return ( offset + snapshot_alignment - 1 ) / snapshot_alignment * snapshot_alignment;
+}
+
+uint64_t read_snapshot_word( const uint8_t *at )
+{
+    uint64_t ret;
+    memcpy( &ret, at, sizeof( ret ) );
+    return ret;
+}
+
 } // namespace
 
 struct flexbuffer_vector_storage : flexbuffer_storage {
@@ -153,6 +173,24 @@ struct flexbuffer_mmap_storage : flexbuffer_storage {
     }
 };
 
+// One flexbuffer out of a snapshot of many.
+struct flexbuffer_mmap_slice_storage : flexbuffer_storage {
+    std::shared_ptr<mmap_file> mmap_handle_;
+    size_t offset_;
+    size_t size_;
+
+    flexbuffer_mmap_slice_storage( std::shared_ptr<mmap_file> mmap_handle, size_t offset,
+                                   size_t size ) : mmap_handle_{ std::move( mmap_handle ) },
+        offset_{ offset }, size_{ size } {}
+
+    const uint8_t *data() const override {
+        return mmap_handle_->base + offset_;
+    }
+    size_t size() const override {
+        return size_;
+    }
+};
+
 parsed_flexbuffer::parsed_flexbuffer( std::shared_ptr<flexbuffer_storage> storage )
     : storage_{ std::move( storage ) }
 {
@@ -284,10 +322,12 @@ class flexbuffer_disk_cache
         }
 
         bool has_cached_flexbuffer_for_json( const fs::path &json_source_path ) {
+            std::lock_guard<std::mutex> lock( cached_flexbuffers_mutex_ );
             return cached_flexbuffers_.count( json_source_path.u8string() ) > 0;
         }
 
         fs::file_time_type cached_mtime_for_json( const fs::path &json_source_path ) {
+            std::lock_guard<std::mutex> lock( cached_flexbuffers_mutex_ );
             auto it = cached_flexbuffers_.find( json_source_path.u8string() );
             if( it != cached_flexbuffers_.end() ) {
                 return it->second.mtime;
@@ -302,29 +342,44 @@ class flexbuffer_disk_cache
             fs::path root_relative_source_path = lexically_normal_json_source_path.lexically_relative(
                     root_path_ ).lexically_normal();
 
-            // Is there even a potential cached flexbuffer for this file.
-            auto disk_entry = cached_flexbuffers_.find( root_relative_source_path.u8string() );
-            if( disk_entry == cached_flexbuffers_.end() ) {
-                return storage;
+            const std::string key = root_relative_source_path.u8string();
+            disk_cache_entry entry;
+            {
+                std::lock_guard<std::mutex> lock( cached_flexbuffers_mutex_ );
+                // Is there even a potential cached flexbuffer for this file.
+                auto disk_entry = cached_flexbuffers_.find( key );
+                if( disk_entry == cached_flexbuffers_.end() ) {
+                    return storage;
+                }
+                entry = disk_entry->second;
             }
 
             std::error_code ec;
-            fs::file_time_type source_mtime = get_file_mtime_millis( lexically_normal_json_source_path, ec );
+            fs::file_time_type source_mtime =
+                get_file_mtime_millis( lexically_normal_json_source_path, ec );
             if( ec ) {
                 return storage;
             }
 
             // Does the source file's mtime match what we cached previously
-            if( source_mtime != disk_entry->second.mtime ) {
+            if( source_mtime != entry.mtime ) {
                 // Cached flexbuffer on disk is out of date, remove it.
-                remove_file( disk_entry->second.flexbuffer_path.u8string() );
-                cached_flexbuffers_.erase( disk_entry );
+                {
+                    std::lock_guard<std::mutex> lock( cached_flexbuffers_mutex_ );
+                    auto disk_entry = cached_flexbuffers_.find( key );
+                    // Another thread may have cached a fresh one meanwhile
+                    if( disk_entry != cached_flexbuffers_.end() &&
+                        disk_entry->second.flexbuffer_path == entry.flexbuffer_path ) {
+                        cached_flexbuffers_.erase( disk_entry );
+                    }
+                }
+                remove_file( entry.flexbuffer_path.u8string() );
                 return storage;
             }
+            const fs::path &flexbuffer_path = entry.flexbuffer_path;
 
             // Try to mmap the cached flexbuffer
-            std::shared_ptr<mmap_file> mmap_handle = mmap_file::map_file(
-                        disk_entry->second.flexbuffer_path.u8string() );
+            std::shared_ptr<mmap_file> mmap_handle = mmap_file::map_file( flexbuffer_path.u8string() );
             if( !mmap_handle ) {
                 return storage;
             }
@@ -337,7 +392,10 @@ class flexbuffer_disk_cache
         bool save_to_disk( const fs::path &lexically_normal_json_source_path,
                            const std::vector<uint8_t> &flexbuffer_binary ) {
             std::error_code ec;
-            std::string json_source_path_string = lexically_normal_json_source_path.u8string();
+            // Indexed by the root relative path like the cached flexbuffers found on startup, so
+            // load_flexbuffer_if_not_stale() finds this one too.
+            fs::path root_relative_path = lexically_normal_json_source_path.lexically_relative(
+                                              root_path_ ).lexically_normal();
             fs::file_time_type mtime = get_file_mtime_millis( lexically_normal_json_source_path, ec );
             if( ec ) {
                 return false;
@@ -366,12 +424,160 @@ class flexbuffer_disk_cache
             }
 
             fb.close();
-            cached_flexbuffers_[json_source_path_string] = disk_cache_entry{ flexbuffer_path, mtime };
+            std::lock_guard<std::mutex> lock( cached_flexbuffers_mutex_ );
+            cached_flexbuffers_[root_relative_path.u8string()] = disk_cache_entry{ flexbuffer_path,
+                                                                  mtime };
 
             return true;
         }
 
+        std::vector<std::shared_ptr<parsed_flexbuffer>> load_snapshot(
+            const std::vector<fs::path> &json_source_paths ) {
+            std::vector<std::shared_ptr<parsed_flexbuffer>> ret;
+            fs::path snapshot_path;
+            std::string key;
+            std::vector<fs::file_time_type> mtimes;
+            if( !snapshot_path_and_key( json_source_paths, snapshot_path, key, mtimes ) ) {
+                return ret;
+            }
+
+            std::shared_ptr<mmap_file> snapshot = mmap_file::map_file( snapshot_path );
+            if( !snapshot ) {
+                return ret;
+            }
+            const uint8_t *base = snapshot->base;
+            const size_t len = snapshot->len;
+            size_t at = sizeof( snapshot_magic );
+            if( len < at + 2 * sizeof( uint64_t ) ||
+                memcmp( base, snapshot_magic, sizeof( snapshot_magic ) ) != 0 ) {
+                return ret;
+            }
+            const uint64_t key_size = read_snapshot_word( base + at );
+            const uint64_t count = read_snapshot_word( base + at + sizeof( uint64_t ) );
+            at += 2 * sizeof( uint64_t );
+            if( key_size != key.size() || count != json_source_paths.size() ||
+                len - at < key_size || key.compare( 0, key.size(),
+                        reinterpret_cast<const char *>( base + at ), key_size ) != 0 ) {
+                // Some of the files changed since the snapshot was taken.
+                return ret;
+            }
+            at = align_snapshot_offset( at + key_size );
+            if( at > len || ( len - at ) / ( 2 * sizeof( uint64_t ) ) < count ) {
+                return ret;
+            }
+
+            ret.reserve( count );
+            for( size_t i = 0; i < count; ++i, at += 2 * sizeof( uint64_t ) ) {
+                const uint64_t offset = read_snapshot_word( base + at );
+                const uint64_t size = read_snapshot_word( base + at + sizeof( uint64_t ) );
+                if( offset > len || size > len - offset ) {
+                    ret.clear();
+                    return ret;
+                }
+                auto storage = std::make_shared<flexbuffer_mmap_slice_storage>( snapshot, offset,
+                               size );
+                ret.emplace_back( std::make_shared<file_flexbuffer>( std::move( storage ),
+                                  fs::path( json_source_paths[i] ), mtimes[i], 0 ) );
+            }
+            return ret;
+        }
+
+        bool save_snapshot( const std::vector<fs::path> &json_source_paths ) {
+            fs::path snapshot_path;
+            std::string key;
+            std::vector<fs::file_time_type> mtimes;
+            if( !snapshot_path_and_key( json_source_paths, snapshot_path, key, mtimes ) ) {
+                return false;
+            }
+
+            // Every file was just parsed and cached on its own, so the snapshot is put together
+            // from those cached flexbuffers.
+            std::vector<std::shared_ptr<flexbuffer_mmap_storage>> buffers;
+            buffers.reserve( json_source_paths.size() );
+            for( const fs::path &source : json_source_paths ) {
+                std::shared_ptr<flexbuffer_mmap_storage> buffer =
+                    load_flexbuffer_if_not_stale( source );
+                if( !buffer ) {
+                    return false;
+                }
+                buffers.emplace_back( std::move( buffer ) );
+            }
+
+            std::vector<uint64_t> table;
+            table.reserve( 2 * buffers.size() );
+            size_t at = align_snapshot_offset( sizeof( snapshot_magic ) + 2 * sizeof( uint64_t ) +
+                                               key.size() );
+            at += 2 * sizeof( uint64_t ) * buffers.size();
+            for( const std::shared_ptr<flexbuffer_mmap_storage> &buffer : buffers ) {
+                at = align_snapshot_offset( at );
+                table.push_back( at );
+                table.push_back( buffer->size() );
+                at += buffer->size();
+            }
+
+            assure_dir_exist( snapshot_path.parent_path() );
+            fs::path temp_path = snapshot_path;
+            temp_path += fs::u8path( ".tmp" );
+            {
+                std::ofstream out( temp_path, std::ofstream::binary );
+                size_t written = 0;
+                const auto write = [&]( const void *data, size_t size ) {
+                    out.write( static_cast<const char *>( data ), size );
+                    written += size;
+                };
+                const auto pad = [&]() {
+                    static constexpr char zeros[snapshot_alignment] = {};
+                    write( zeros, align_snapshot_offset( written ) - written );
+                };
+                const uint64_t key_size = key.size();
+                const uint64_t count = buffers.size();
+                write( snapshot_magic, sizeof( snapshot_magic ) );
+                write( &key_size, sizeof( key_size ) );
+                write( &count, sizeof( count ) );
+                write( key.data(), key.size() );
+                pad();
+                write( table.data(), table.size() * sizeof( uint64_t ) );
+                for( const std::shared_ptr<flexbuffer_mmap_storage> &buffer : buffers ) {
+                    pad();
+                    write( buffer->data(), buffer->size() );
+                }
+                if( !out.good() ) {
+                    out.close();
+                    remove_file( temp_path );
+                    return false;
+                }
+            }
+            // Written under another name first, so a partly written snapshot is never loaded.
+            return rename_file( temp_path, snapshot_path );
+        }
+
     private:
+        // Snapshots are named after their set of files, so a newer snapshot of the same files
+        // replaces the older one.  The key stored inside also has the mtimes of the files.
+        bool snapshot_path_and_key( const std::vector<fs::path> &json_source_paths,
+                                    fs::path &snapshot_path, std::string &key,
+                                    std::vector<fs::file_time_type> &mtimes ) const {
+            std::string names;
+            for( const fs::path &source : json_source_paths ) {
+                std::error_code ec;
+                const fs::file_time_type mtime = get_file_mtime_millis( source, ec );
+                if( ec ) {
+                    return false;
+                }
+                const std::string name = source.lexically_relative(
+                                             root_path_ ).lexically_normal().generic_u8string();
+                names += name + '\n';
+                const int64_t mtime_ms = std::chrono::duration_cast<std::chrono::milliseconds>
+                                         ( mtime.time_since_epoch() ).count();
+                key += name + '\n' + std::to_string( mtime_ms ) + '\n';
+                mtimes.push_back( mtime );
+            }
+            const std::string snapshot_name = std::to_string( std::hash<std::string>()( names ) );
+            snapshot_path = cache_path_ / fs::u8path( "snapshots" ) /
+                            fs::u8path( snapshot_name + ".snapshot" );
+            return true;
+        }
+
         explicit flexbuffer_disk_cache( fs::path cache_path, fs::path root_path ) : cache_path_{ std::move( cache_path ) },
             root_path_{ std::move( root_path ) } {}
 
@@ -384,6 +590,8 @@ class flexbuffer_disk_cache
         };
         // Maps game root relative json source path to the most recent cached flexbuffer we have on disk for it.
         std::unordered_map<std::string, disk_cache_entry> cached_flexbuffers_;
+        // Data files are parsed on several threads at once while loading.
+        std::mutex cached_flexbuffers_mutex_;
 };
 
 flexbuffer_cache::flexbuffer_cache( const fs::path &cache_directory,
@@ -469,6 +677,24 @@ std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse_and_cache(
             mtime, offset );
 }
 
+std::vector<std::shared_ptr<parsed_flexbuffer>> flexbuffer_cache::load_snapshot(
+            const std::vector<fs::path> &lexically_normal_json_source_paths )
+{
+    if( !disk_cache_ ) {
+        return {};
+    }
+    return disk_cache_->load_snapshot( lexically_normal_json_source_paths );
+}
+
+bool flexbuffer_cache::save_snapshot( const std::vector<fs::path>
+                                      &lexically_normal_json_source_paths )
+{
+    if( !disk_cache_ ) {
+        return false;
+    }
+    return disk_cache_->save_snapshot( lexically_normal_json_source_paths );
+}
+
 std::shared_ptr<parsed_flexbuffer> flexbuffer_cache::parse_buffer( std::string buffer )
 {
     std::vector<uint8_t> fb = parse_json_to_flexbuffer_( buffer.c_str(), nullptr );
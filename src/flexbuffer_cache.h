@@ -5,6 +5,7 @@
 #include <iosfwd>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <flatbuffers/flexbuffers.h>
 
@@ -62,6 +63,15 @@ class flexbuffer_cache
 
         static shared_flexbuffer parse_buffer( std::string buffer ) noexcept( false );
 
+        // Returns the flexbuffers of all the given files, in order, from one snapshot file.
+        // Returns an empty vector if there's no snapshot of exactly these files as they are now.
+        std::vector<shared_flexbuffer> load_snapshot(
+            const std::vector<fs::path> &lexically_normal_json_source_paths );
+        // Puts the cached flexbuffers of all the given files into one snapshot file for
+        // load_snapshot().  Returns false if some file isn't cached or the snapshot can't be
+        // written.
+        bool save_snapshot( const std::vector<fs::path> &lexically_normal_json_source_paths );
+
     private:
         flexbuffer_cache( flexbuffer_cache && ) noexcept = default;
 
@@ -746,6 +746,16 @@ void game::setup()
         load_core_data( ui );
     }
     load_world_modfiles( ui );
+#if defined(TILES)
+    // Tiles may fall back on the looks_like of the data that was just loaded
+    for( cata_tiles *context : {
+             closetilecontext.get(), fartilecontext.get(), overmap_tilecontext.get()
+         } ) {
+        if( context ) {
+            context->clear_tile_lookup_cache();
+        }
+    }
+#endif
     // Panel manager needs JSON data to be loaded before init
     panel_manager::get_manager().init();
 
@@ -7979,13 +7989,14 @@ look_around_result game::look_around( look_around_params looka_params )
 static void add_item_recursive( std::vector<std::string> &item_order,
                                 std::map<std::string, map_item_stack> &temp_items, const item *it, const tripoint &relative_pos )
 {
-    const std::string name = it->tname();
+    std::string name = it->tname();
 
-    if( std::find( item_order.begin(), item_order.end(), name ) == item_order.end() ) {
+    auto stack = temp_items.find( name );
+    if( stack == temp_items.end() ) {
         item_order.push_back( name );
-        temp_items[name] = map_item_stack( it, relative_pos );
+        temp_items.emplace( std::move( name ), map_item_stack( it, relative_pos ) );
     } else {
-        temp_items[name].add_at_pos( it, relative_pos );
+        stack->second.add_at_pos( it, relative_pos );
     }
 
     for( const item *content : it->all_known_contents() ) {
@@ -8016,8 +8027,9 @@ std::vector<map_item_stack> game::find_nearby_items( int iRadius )
         }
     }
 
-    for( auto &elem : item_order ) {
-        ret.push_back( temp_items[elem] );
+    ret.reserve( item_order.size() );
+    for( const std::string &elem : item_order ) {
+        ret.push_back( std::move( temp_items[elem] ) );
     }
 
     return ret;
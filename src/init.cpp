@@ -1,10 +1,14 @@
 #include "init.h"
 
+#include <chrono>
 #include <cstddef>
+#include <future>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <vector>
 
 #include "achievement.h"
@@ -18,6 +22,7 @@
 #include "bodygraph.h"
 #include "bodypart.h"
 #include "butchery_requirements.h"
+#include "cached_options.h"
 #include "cata_assert.h"
 #include "cata_scope_helpers.h"
 #include "character_modifier.h"
@@ -511,16 +516,30 @@ void DynamicDataLoader::load_data_from_path( const cata_path &path, const std::s
         files.emplace_back( path );
     }
 
-    // iterate over each file
-    for( const cata_path &file : files ) {
-        try {
-            // parse it
-            JsonValue jsin = json_loader::from_path( file );
-            load_all_from_json( jsin, src, ui, path, file );
-        } catch( const JsonError &err ) {
-            throw std::runtime_error( err.what() );
+    if( data_snapshot ) {
+        if( std::optional<std::vector<JsonValue>> snapshot = json_loader::from_snapshot( files ) ) {
+            for( size_t i = 0; i < files.size(); ++i ) {
+                try {
+                    load_all_from_json( ( *snapshot )[i], src, ui, path, files[i] );
+                } catch( const JsonError &err ) {
+                    throw std::runtime_error( err.what() );
+                }
+            }
+            return;
         }
     }
+
+    try {
+        json_loader::for_each_from_paths( files, [&]( const cata_path & file,
+        const JsonValue & jsin ) {
+            load_all_from_json( jsin, src, ui, path, file );
+        } );
+    } catch( const JsonError &err ) {
+        throw std::runtime_error( err.what() );
+    }
+    if( data_snapshot ) {
+        json_loader::save_snapshot( files );
+    }
 }
 
 void DynamicDataLoader::load_all_from_json( const JsonValue &jsin, const std::string &src,
@@ -827,7 +846,6 @@ void DynamicDataLoader::check_consistency( loading_ui &ui )
             { _( "Profession groups" ), &profession_group::check_profession_group_consistency },
             { _( "Martial arts" ), &check_martialarts },
             { _( "Climbing aid" ), &climbing_aid::check_consistency },
-            { _( "Mutations" ), &mutation_branch::check_consistency },
             { _( "Mutation categories" ), &mutation_category_trait::check_consistency },
             { _( "Region settings" ), check_region_settings },
             { _( "Overmap land use codes" ), &overmap_land_use_codes::check_consistency },
@@ -840,10 +858,7 @@ void DynamicDataLoader::check_consistency( loading_ui &ui )
             { _( "Shop rates" ), &shopkeeper_cons_rates::check_all },
             { _( "Start locations" ), &start_locations::check_consistency },
             { _( "Ammunition types" ), &ammunition_type::check_consistency },
-            { _( "Traps" ), &trap::check_consistency },
-            { _( "Bionics" ), &bionic_data::check_bionic_consistency },
             { _( "Gates" ), &gates::check },
-            { _( "NPC classes" ), &npc_class::check_consistency },
             { _( "Behaviors" ), &behavior::check_consistency },
             { _( "Mission types" ), &mission_type::check_consistency },
             {
@@ -852,12 +867,10 @@ void DynamicDataLoader::check_consistency( loading_ui &ui )
                     item_action_generator::generator().check_consistency();
                 }
             },
-            { _( "Harvest lists" ), &harvest_list::check_consistency },
             { _( "NPC templates" ), &npc_template::check_consistency },
             { _( "Body parts" ), &body_part_type::check_consistency },
             { _( "Body graphs" ), &bodygraph::check_all },
             { _( "Anatomies" ), &anatomy::check_consistency },
-            { _( "Spells" ), &spell_type::check_consistency },
             { _( "Transformations" ), &event_transformation::check_consistency },
             { _( "Statistics" ), &event_statistic::check_consistency },
             { _( "Scent types" ), &scent_type::check_scent_consistency },
@@ -868,14 +881,68 @@ void DynamicDataLoader::check_consistency( loading_ui &ui )
             { _( "Damage types" ), &damage_type::check }
         }
     };
+    // These only read the finalized data, and only look up the ids stored in their own types,
+    // so they run at the same time on worker threads once the checks above are done.  Their
+    // debugmsgs are deferred and reported in this order.
+    const std::vector<named_entry> parallel_entries = {{
+            { _( "Traps" ), &trap::check_consistency },
+            { _( "Harvest lists" ), &harvest_list::check_consistency },
+            { _( "NPC classes" ), &npc_class::check_consistency },
+            { _( "Spells" ), &spell_type::check_consistency },
+            { _( "Bionics" ), &bionic_data::check_bionic_consistency },
+            { _( "Mutations" ), &mutation_branch::check_consistency }
+        }
+    };
 
     for( const named_entry &e : entries ) {
         ui.add_entry( e.first );
     }
+    for( const named_entry &e : parallel_entries ) {
+        ui.add_entry( e.first );
+    }
 
     ui.show();
     for( const named_entry &e : entries ) {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
         e.second();
+        const std::chrono::milliseconds elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+                ( std::chrono::steady_clock::now() - start );
+        DebugLog( D_INFO, DC_ALL ) << "Verified " << e.first << " in " << elapsed.count() << " ms";
+        ui.proceed();
+    }
+
+    struct parallel_result {
+        std::vector<deferred_debugmsg> debugmsgs;
+        std::chrono::milliseconds elapsed;
+    };
+    std::vector<std::future<parallel_result>> results;
+    results.reserve( parallel_entries.size() );
+    bool use_threads = true;
+    for( const named_entry &e : parallel_entries ) {
+        const auto check = [&e]() {
+            parallel_result result;
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            result.debugmsgs = defer_debugmsgs_during( e.second );
+            result.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+                             ( std::chrono::steady_clock::now() - start );
+            return result;
+        };
+        if( use_threads ) {
+            try {
+                results.emplace_back( std::async( std::launch::async, check ) );
+                continue;
+            } catch( const std::system_error & ) {
+                // No threads (e.g. the emscripten build), run the rest on this thread in order.
+                use_threads = false;
+            }
+        }
+        results.emplace_back( std::async( std::launch::deferred, check ) );
+    }
+    for( size_t i = 0; i < parallel_entries.size(); ++i ) {
+        const parallel_result result = results[i].get();
+        replay_deferred_debugmsgs( result.debugmsgs );
+        DebugLog( D_INFO, DC_ALL ) << "Verified " << parallel_entries[i].first << " in " <<
+                                   result.elapsed.count() << " ms";
         ui.proceed();
     }
 }
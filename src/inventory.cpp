@@ -241,6 +241,7 @@ inventory inventory::operator+ ( const item &rhs )
 void inventory::unsort()
 {
     binned = false;
+    stacks_by_type.invalidate();
 }
 
 static bool stack_compare( const std::list<item> &lhs, const std::list<item> &rhs )
@@ -253,6 +254,7 @@ void inventory::clear()
     items.clear();
     max_empty_liq_cont.clear();
     binned = false;
+    stacks_by_type.invalidate();
     qualities_cache.clear();
 }
 
@@ -298,33 +300,61 @@ char inventory::find_usable_cached_invlet( const itype_id &item_type )
     return 0;
 }
 
+std::vector<std::list<item> *> &inventory::stacks_of_type( const itype *type )
+{
+    if( !stacks_by_type.valid ) {
+        stacks_by_type.by_type.clear();
+        for( std::list<item> &elem : items ) {
+            stacks_by_type.by_type[elem.front().type].push_back( &elem );
+        }
+        stacks_by_type.valid = true;
+    }
+    return stacks_by_type.by_type[type];
+}
+
 item &inventory::add_item( item newit, bool keep_invlet, bool assign_invlet, bool should_stack )
 {
     binned = false;
 
     Character &player_character = get_player_character();
+    // Returns the merged item if newit could be stacked onto elem
+    const auto try_stack = [&]( std::list<item> &elem ) -> item * {
+        std::list<item>::iterator it_ref = elem.begin();
+        if( !it_ref->stacks_with( newit ) ) {
+            return nullptr;
+        }
+        if( it_ref->merge_charges( newit ) ) {
+            return &*it_ref;
+        }
+        if( it_ref->invlet == '\0' ) {
+            if( !keep_invlet ) {
+                update_invlet( newit, assign_invlet );
+            }
+            update_cache_with_item( newit );
+            it_ref->invlet = newit.invlet;
+        } else {
+            newit.invlet = it_ref->invlet;
+        }
+        elem.emplace_back( std::move( newit ) );
+        return &elem.back();
+    };
     if( should_stack ) {
-        // See if we can't stack this item.
-        for( auto &elem : items ) {
-            std::list<item>::iterator it_ref = elem.begin();
-            if( it_ref->stacks_with( newit ) ) {
-                if( it_ref->merge_charges( newit ) ) {
-                    return *it_ref;
+        if( keep_invlet && assign_invlet ) {
+            // See if we can't stack this item.
+            for( auto &elem : items ) {
+                if( item *stacked = try_stack( elem ) ) {
+                    return *stacked;
+                } else if( elem.front().invlet == newit.invlet ) {
+                    // If keep_invlet is true, we'll be forcing other items out of their current invlet.
+                    assign_empty_invlet( elem.front(), player_character );
                 }
-                if( it_ref->invlet == '\0' ) {
-                    if( !keep_invlet ) {
-                        update_invlet( newit, assign_invlet );
-                    }
-                    update_cache_with_item( newit );
-                    it_ref->invlet = newit.invlet;
-                } else {
-                    newit.invlet = it_ref->invlet;
+            }
+        } else {
+            // Items of different types never stack, so only look at stacks of the same type.
+            for( std::list<item> *elem : stacks_of_type( newit.type ) ) {
+                if( item *stacked = try_stack( *elem ) ) {
+                    return *stacked;
                 }
-                elem.emplace_back( std::move( newit ) );
-                return elem.back();
-            } else if( keep_invlet && assign_invlet && it_ref->invlet == newit.invlet ) {
-                // If keep_invlet is true, we'll be forcing other items out of their current invlet.
-                assign_empty_invlet( *it_ref, player_character );
             }
         }
     }
@@ -336,6 +366,9 @@ item &inventory::add_item( item newit, bool keep_invlet, bool assign_invlet, boo
     update_cache_with_item( newit );
 
     items.emplace_back( std::list<item> { std::move( newit ) } );
+    if( stacks_by_type.valid ) {
+        stacks_by_type.by_type[items.back().front().type].push_back( &items.back() );
+    }
     return items.back().back();
 }
 
@@ -394,6 +427,7 @@ void inventory::restack( Character &p )
     // 3. combine matching stacks
 
     binned = false;
+    stacks_by_type.invalidate();
     std::list<item> to_restack;
     int idx = 0;
     for( invstack::iterator iter = items.begin(); iter != items.end(); ++iter, ++idx ) {
@@ -521,6 +555,7 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
                                bool assign_invlet )
 {
     items.clear();
+    stacks_by_type.invalidate();
     provisioned_pseudo_tools.clear();
 
     for( const tripoint &p : pts ) {
@@ -604,6 +639,7 @@ std::list<item> inventory::reduce_stack( const int position, const int quantity
     for( invstack::iterator iter = items.begin(); iter != items.end(); ++iter ) {
         if( position == pos ) {
             binned = false;
+            stacks_by_type.invalidate();
             if( quantity >= static_cast<int>( iter->size() ) || quantity < 0 ) {
                 ret = *iter;
                 items.erase( iter );
@@ -638,6 +674,7 @@ item inventory::remove_item( const int position )
     for( invstack::iterator iter = items.begin(); iter != items.end(); ++iter ) {
         if( position == pos ) {
             binned = false;
+            stacks_by_type.invalidate();
             if( iter->size() > 1 ) {
                 std::list<item>::iterator stack_member = iter->begin();
                 char invlet = stack_member->invlet;
@@ -683,6 +720,7 @@ std::list<item> inventory::remove_randomly_by_volume( const units::volume &volum
         }
         if( chosen_stack->empty() ) {
             binned = false;
+            stacks_by_type.invalidate();
             items.erase( chosen_stack );
         }
     }
@@ -766,6 +804,7 @@ std::list<item> inventory::use_amount( const itype_id &it, int quantity,
                                        const std::function<bool( const item & )> &filter )
 {
     items.sort( stack_compare );
+    stacks_by_type.invalidate();
     std::list<item> ret;
     for( invstack::iterator iter = items.begin(); iter != items.end() && quantity > 0; /* noop */ ) {
         for( std::list<item>::iterator stack_iter = iter->begin();
@@ -986,12 +1025,12 @@ enchant_cache inventory::get_active_enchantment_cache( const Character &owner )
 int inventory::count_item( const itype_id &item_type ) const
 {
     int num = 0;
-    const itype_bin bin = get_binned_items();
-    if( bin.find( item_type ) == bin.end() ) {
+    const itype_bin &bin = get_binned_items();
+    const auto iter = bin.find( item_type );
+    if( iter == bin.end() ) {
         return num;
     }
-    const std::list<const item *> items = get_binned_items().find( item_type )->second;
-    for( const item *it : items ) {
+    for( const item *it : iter->second ) {
         num += it->count();
     }
     return num;
@@ -1120,6 +1159,8 @@ const itype_bin &inventory::get_binned_items() const
     }
 
     binned_items.clear();
+    qualities_cache.clear();
+    max_quality_cache.clear();
 
     // HACK: Hack warning
     inventory *this_nonconst = const_cast<inventory *>( this );
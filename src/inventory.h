@@ -252,6 +252,7 @@ class inventory : public visitable
 
         // inherited from `visitable`
         bool has_quality( const quality_id &qual, int level = 1, int qty = 1 ) const override;
+        int max_quality( const quality_id &qual ) const override;
         VisitResponse visit_items( const std::function<VisitResponse( item *, item * )> &func ) const
         override;
         std::list<item> remove_items_with( const std::function<bool( const item & )> &filter,
@@ -279,6 +280,45 @@ class inventory : public visitable
 
         invstack items;
 
+        /**
+         * Stacks of @ref items grouped by the type of their items, in the same order as in @ref items.
+         * Only stacks of the same type can accept a new item, so @ref add_item uses this to avoid
+         * comparing the new item against every stack when building large inventories (e.g. from a
+         * stockpile in @ref form_from_map).
+         * Holds pointers into @ref items, therefore copies start out invalid and are rebuilt on demand.
+         */
+        class stack_index
+        {
+            public:
+                stack_index() = default;
+                stack_index( const stack_index & ) {}
+                stack_index( stack_index &&other ) noexcept : valid( other.valid ),
+                    by_type( std::move( other.by_type ) ) {
+                    other.invalidate();
+                }
+                stack_index &operator=( const stack_index & ) {
+                    invalidate();
+                    return *this;
+                }
+                stack_index &operator=( stack_index &&other ) noexcept {
+                    valid = other.valid;
+                    by_type = std::move( other.by_type );
+                    other.invalidate();
+                    return *this;
+                }
+
+                void invalidate() {
+                    valid = false;
+                    by_type.clear();
+                }
+
+                bool valid = false;
+                std::unordered_map<const itype *, std::vector<std::list<item> *>> by_type;
+        };
+        stack_index stacks_by_type;
+        /** Rebuilds @ref stacks_by_type if needed and returns the stacks that hold items of type @p type. */
+        std::vector<std::list<item> *> &stacks_of_type( const itype *type );
+
         std::map<itype_id, int> max_empty_liq_cont;
 
         // tracker for provide_pseudo_item to prevent duplicate tools/liquids
@@ -292,7 +332,12 @@ class inventory : public visitable
          */
         mutable itype_bin binned_items;
 
+        /**
+         * Results of @ref has_quality and @ref max_quality.
+         * Derived from the same data as @ref binned_items and reset whenever they are rebuilt.
+         */
         mutable std::map<quality_query, bool> qualities_cache;
+        mutable std::unordered_map<quality_id, int> max_quality_cache;
 };
 
 #endif // CATA_SRC_INVENTORY_H
@@ -1277,22 +1277,53 @@ void inventory_column::on_change( const inventory_entry &/* entry */ )
     // stub
 }
 
+std::vector<size_t> &inventory_column::entries_of_type( const entries_t &ent, entry_index &index,
+        const itype *type )
+{
+    if( !index.valid || index.indexed_size != ent.size() ) {
+        index.by_type.clear();
+        for( size_t i = 0; i < ent.size(); i++ ) {
+            if( ent[i].is_item() ) {
+                index.by_type[ent[i].locations.front()->type].push_back( i );
+            }
+        }
+        index.indexed_size = ent.size();
+        index.valid = true;
+    }
+    return index.by_type[type];
+}
+
+void inventory_column::invalidate_entry_index()
+{
+    entries_index.valid = false;
+    entries_hidden_index.valid = false;
+}
+
 inventory_entry *inventory_column::add_entry( const inventory_entry &entry )
 {
-    entries_t &dest = entry.is_hidden( hide_entries_override ) ? entries_hidden : entries;
-    if( auto it = std::find( dest.begin(), dest.end(), entry ); it != dest.end() ) {
-        debugmsg( "Tried to add a duplicate entry." );
-        return &*it;
+    const bool hidden = entry.is_hidden( hide_entries_override );
+    entries_t &dest = hidden ? entries_hidden : entries;
+    if( !entry.is_item() ) {
+        if( auto it = std::find( dest.begin(), dest.end(), entry ); it != dest.end() ) {
+            debugmsg( "Tried to add a duplicate entry." );
+            return &*it;
+        }
     }
     paging_is_valid = false;
+    entry_index &index = hidden ? entries_hidden_index : entries_index;
     if( entry.is_item() ) {
         item_location entry_item = entry.locations.front();
+        // Duplicates and stacks both have a first item of the same type
+        const std::vector<size_t> &same_type = entries_of_type( dest, index, entry_item->type );
 
-        auto entry_with_loc = std::find_if( dest.begin(),
-        dest.end(), [&entry, &entry_item, this]( const inventory_entry & e ) {
-            if( !e.is_item() ) {
-                return false;
+        for( size_t i : same_type ) {
+            if( dest[i] == entry ) {
+                debugmsg( "Tried to add a duplicate entry." );
+                return &dest[i];
             }
+        }
+
+        auto stacks_with_entry = [&entry, &entry_item, this]( const inventory_entry & e ) {
             item_location found_entry_item = e.locations.front();
             return !e.is_collated() &&
                    e.get_category_ptr() == entry.get_category_ptr() &&
@@ -1303,17 +1334,25 @@ inventory_entry *inventory_column::add_entry( const inventory_entry &entry )
                    entry_item->link_length() == found_entry_item->link_length() &&
                    entry_item->max_link_length() == found_entry_item->max_link_length() &&
                    entry_item->display_stacked_with( *found_entry_item, preset.get_checking_components() );
-        } );
-        if( entry_with_loc != dest.end() ) {
-            std::vector<item_location> &locations = entry_with_loc->locations;
-            std::move( entry.locations.begin(), entry.locations.end(), std::back_inserter( locations ) );
-            return &*entry_with_loc;
+        };
+        for( size_t i : same_type ) {
+            if( stacks_with_entry( dest[i] ) ) {
+                std::vector<item_location> &locations = dest[i].locations;
+                std::move( entry.locations.begin(), entry.locations.end(), std::back_inserter( locations ) );
+                return &dest[i];
+            }
         }
     }
 
     dest.emplace_back( entry );
     inventory_entry &newent = dest.back();
     newent.update_cache();
+    if( index.valid && index.indexed_size + 1 == dest.size() ) {
+        if( newent.is_item() ) {
+            index.by_type[newent.locations.front()->type].push_back( dest.size() - 1 );
+        }
+        index.indexed_size = dest.size();
+    }
 
     return &newent;
 }
@@ -1323,6 +1362,7 @@ void inventory_column::move_entries_to( inventory_column &dest )
     std::move( entries.begin(), entries.end(), std::back_inserter( dest.entries ) );
     std::move( entries_hidden.begin(), entries_hidden.end(),
                std::back_inserter( dest.entries_hidden ) );
+    dest.invalidate_entry_index();
     dest.paging_is_valid = false;
     clear();
 }
@@ -1410,6 +1450,7 @@ bool inventory_column::collated_sort_compare( inventory_entry const &lhs,
 
 void inventory_column::collate()
 {
+    invalidate_entry_index();
     for( auto outer = entries.begin(); outer != entries.end(); ++outer ) {
         if( !outer->is_item() || outer->is_collated() || outer->chevron ) {
             continue;
@@ -1463,6 +1504,7 @@ void inventory_column::_reset_collation( entries_t &entries )
 void inventory_column::uncollate()
 {
     if( _collated ) {
+        invalidate_entry_index();
         _reset_collation( entries );
         _reset_collation( entries_hidden );
         _collated = false;
@@ -1474,6 +1516,7 @@ void inventory_column::prepare_paging( const std::string &filter )
     if( paging_is_valid ) {
         return;
     }
+    invalidate_entry_index();
 
     const auto filter_fn = filter_from_string<inventory_entry>(
     filter, [this]( const std::string & filter ) {
@@ -1552,6 +1595,7 @@ void inventory_column::clear()
 {
     entries.clear();
     entries_hidden.clear();
+    invalidate_entry_index();
     paging_is_valid = false;
 }
 
@@ -1856,6 +1900,7 @@ void selection_column::on_change( const inventory_entry &entry )
             iter->make_entry_cell_cache( preset );
         } else {
             iter = entries.erase( iter );
+            invalidate_entry_index();
         }
         paging_is_valid = false;
         if( iter != entries.end() ) {
@@ -11,6 +11,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -542,6 +543,9 @@ class inventory_column
         size_t reserved_width = 0;
         std::optional<bool> hide_entries_override = std::nullopt;
 
+        /** Must be called after entries or entries_hidden are reordered or removed */
+        void invalidate_entry_index();
+
     private:
         struct cell_t {
             size_t current_width = 0;   /// Current cell widths (can be affected by set_width())
@@ -566,6 +570,21 @@ class inventory_column
         static void _move_entries_to( entries_t const &ent, inventory_column &dest );
         static void _reset_collation( entries_t &ent );
 
+        /**
+         * Indices of the item entries in an entries_t by the type of their first item,
+         * so add_entry() only has to look at the entries the new one could stack with.
+         * Rebuilt on demand when invalid or when the size no longer matches.
+         */
+        struct entry_index {
+            std::unordered_map<const itype *, std::vector<size_t>> by_type;
+            size_t indexed_size = 0;
+            bool valid = false;
+        };
+        entry_index entries_index;
+        entry_index entries_hidden_index;
+        std::vector<size_t> &entries_of_type( const entries_t &ent, entry_index &index,
+                                              const itype *type );
+
         bool skip_unselectable = false;
         bool _collated = false;
 };
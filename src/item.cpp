@@ -1798,29 +1798,22 @@ void item::force_insert_item( const item &it, pocket_type pk_type )
     update_inherited_flags();
 }
 
+// std::to_string never uses digit grouping, so it matches the classic locale for integers
+// without the cost of setting up a stream for every variable that is set.
 void item::set_var( const std::string &name, const int value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars[name] = std::to_string( value );
 }
 
 void item::set_var( const std::string &name, const long long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars[name] = std::to_string( value );
 }
 
 // NOLINTNEXTLINE(cata-no-long)
 void item::set_var( const std::string &name, const long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars[name] = std::to_string( value );
 }
 
 void item::set_var( const std::string &name, const double value )
@@ -1876,20 +1869,22 @@ tripoint item::get_var( const std::string &name, const tripoint &default_value )
     if( it == item_vars.end() ) {
         return default_value;
     }
-    std::vector<std::string> values = string_split( it->second, ',' );
-    cata_assert( values.size() == 3 );
-    auto convert_or_error = []( const std::string_view s ) {
-        ret_val<int> result = try_parse_integer<int>( s, false );
+    // Parse the "x,y,z" in place, this is read when comparing items for stacking
+    const std::string_view val = it->second;
+    std::array<int, 3> coords = {};
+    size_t start = 0;
+    for( size_t i = 0; i < coords.size(); ++i ) {
+        const size_t end = i + 1 < coords.size() ? val.find( ',', start ) : val.size();
+        cata_assert( end != std::string_view::npos );
+        ret_val<int> result = try_parse_integer<int>( val.substr( start, end - start ), false );
         if( result.success() ) {
-            return result.value();
+            coords[i] = result.value();
         } else {
             debugmsg( "Error parsing tripoint coordinate in item::get_var: %s", result.str() );
-            return 0;
         }
-    };
-    return tripoint( convert_or_error( values[0] ),
-                     convert_or_error( values[1] ),
-                     convert_or_error( values[2] ) );
+        start = end + 1;
+    }
+    return tripoint( coords[0], coords[1], coords[2] );
 }
 
 void item::set_var( const std::string &name, const std::string &value )
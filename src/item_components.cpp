@@ -5,65 +5,78 @@
 #include "itype.h"
 #include "type_id.h"
 
+const item_components::comp_map &item_components::get_comps() const
+{
+    static const comp_map no_comps;
+    return comps ? *comps : no_comps;
+}
+
+item_components::comp_map &item_components::get_mutable_comps()
+{
+    if( !comps ) {
+        comps = std::make_shared<comp_map>();
+    } else if( comps.use_count() > 1 ) {
+        comps = std::make_shared<comp_map>( *comps );
+    }
+    return *comps;
+}
+
 std::vector<item> item_components::operator[]( const itype_id it_id )
 {
-    return comps[it_id];
+    return get_mutable_comps()[it_id];
 }
 
 item_components::comp_iterator item_components::begin()
 {
-    return comps.begin();
+    return get_mutable_comps().begin();
 }
 item_components::comp_iterator item_components::end()
 {
-    return comps.end();
+    return get_mutable_comps().end();
 }
 item_components::const_comp_iterator item_components::begin() const
 {
-    return comps.begin();
+    return get_comps().begin();
 }
 item_components::const_comp_iterator item_components::end() const
 {
-    return comps.end();
+    return get_comps().end();
 }
 
 bool item_components::empty()
 {
-    return comps.empty();
+    return get_comps().empty();
 }
 
 bool item_components::empty() const
 {
-    return comps.empty();
+    return get_comps().empty();
 }
 
 void item_components::clear()
 {
-    comps.clear();
+    comps.reset();
 }
 
 item item_components::only_item()
 {
-    if( comps.size() != 1 || comps.begin()->second.size() != 1 ) {
-        debugmsg( "item_components::only_item called but components don't contain exactly one item" );
-        return item();
-    }
-    return *comps.begin()->second.begin();
+    return static_cast<const item_components &>( *this ).only_item();
 }
 
 item item_components::only_item() const
 {
-    if( comps.size() != 1 || comps.begin()->second.size() != 1 ) {
+    const comp_map &all_comps = get_comps();
+    if( all_comps.size() != 1 || all_comps.begin()->second.size() != 1 ) {
         debugmsg( "item_components::only_item called but components don't contain exactly one item" );
         return item();
     }
-    return *comps.begin()->second.begin();
+    return *all_comps.begin()->second.begin();
 }
 
 size_t item_components::size() const
 {
     size_t ret = 0;
-    for( const type_vector_pair &tvp : comps ) {
+    for( const type_vector_pair &tvp : get_comps() ) {
         ret += tvp.second.size();
     }
     return ret;
@@ -71,39 +84,42 @@ size_t item_components::size() const
 
 void item_components::add( item &new_it )
 {
-    comp_iterator it = comps.find( new_it.typeId() );
-    if( it != comps.end() ) {
+    comp_map &all_comps = get_mutable_comps();
+    comp_iterator it = all_comps.find( new_it.typeId() );
+    if( it != all_comps.end() ) {
         if( it->first->count_by_charges() ) {
             it->second.front().charges += new_it.charges;
         } else {
             it->second.push_back( new_it );
         }
     } else {
-        comps[new_it.typeId()] = { new_it };
+        all_comps[new_it.typeId()] = { new_it };
     }
 }
 
 ret_val<item> item_components::remove( itype_id it_id )
 {
-    comp_iterator it = comps.find( it_id );
-    if( it == comps.end() ) {
+    if( get_comps().count( it_id ) == 0 ) {
         return ret_val<item>::make_failure( item() );
     }
+    comp_map &all_comps = get_mutable_comps();
+    comp_iterator it = all_comps.find( it_id );
     item itm = *it->second.begin();
     it->second.erase( it->second.begin() );
     if( it->second.empty() ) {
-        comps.erase( it );
+        all_comps.erase( it );
     }
     return ret_val<item>::make_success( itm );
 }
 
 item item_components::get_and_remove_random_entry()
 {
-    comp_iterator iter = comps.begin();
-    std::advance( iter, rng( 0, comps.size() - 1 ) );
+    comp_map &all_comps = get_mutable_comps();
+    comp_iterator iter = all_comps.begin();
+    std::advance( iter, rng( 0, all_comps.size() - 1 ) );
     item ret = random_entry_removed( iter->second );
     if( iter->second.empty() ) {
-        comps.erase( iter );
+        all_comps.erase( iter );
     }
     return ret;
 }
@@ -126,7 +142,7 @@ item_components item_components::split( const int batch_size, const size_t offse
 {
     item_components ret;
 
-    for( item_components::type_vector_pair &tvp : comps ) {
+    for( const item_components::type_vector_pair &tvp : get_comps() ) {
         if( tvp.first->count_by_charges() ) {
             if( tvp.second.size() != 1 ) {
                 debugmsg( "count by charges component %s wasn't merged properly, can't distribute components to resulting items",
@@ -164,12 +180,12 @@ item_components item_components::split( const int batch_size, const size_t offse
 
 void item_components::serialize( JsonOut &jsout ) const
 {
-    jsout.write( comps );
+    jsout.write( get_comps() );
 }
 
 void item_components::deserialize( const JsonValue &jv )
 {
-    comps.clear();
+    comps.reset();
     // read legacy arrays
     if( jv.test_array() ) {
         std::list<item> temp;
@@ -178,6 +194,9 @@ void item_components::deserialize( const JsonValue &jv )
             add( it );
         }
     } else {
-        jv.read( comps );
+        jv.read( get_mutable_comps() );
+        if( comps->empty() ) {
+            comps.reset();
+        }
     }
 }
@@ -4,11 +4,11 @@
 
 #include <iterator>
 #include <map>
+#include <memory>
 #include <set>
 #include <vector>
 
 #include "type_id.h"
-#include "value_ptr.h"
 
 class item;
 class JsonOut;
@@ -16,12 +16,25 @@ class JsonValue;
 template<typename T>
 class ret_val;
 
+/**
+ * The components an item was crafted from.
+ * Copies share the components until one of them is changed, because copying them means
+ * copying every component item (and their components).  The non-const accessors make the
+ * components unique to this object first, so iterators and references obtained from them
+ * must not be used for changes after this object was copied.
+ */
 class item_components
 {
     private:
-        cata::heap<std::map<itype_id, std::vector<item>>> comps;
-        using comp_iterator = std::map<itype_id, std::vector<item>>::iterator;
-        using const_comp_iterator = std::map<itype_id, std::vector<item>>::const_iterator;
+        using comp_map = std::map<itype_id, std::vector<item>>;
+        // nullptr when there are no components
+        std::shared_ptr<comp_map> comps;
+        using comp_iterator = comp_map::iterator;
+        using const_comp_iterator = comp_map::const_iterator;
+
+        const comp_map &get_comps() const;
+        // Makes the components unique to this object, to be changed
+        comp_map &get_mutable_comps();
 
     public:
         using type_vector_pair = std::pair<const itype_id, std::vector<item>>;
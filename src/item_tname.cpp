@@ -86,11 +86,13 @@ std::string pre_asterisk( item const &it, unsigned int /* quantity */,
 std::string durability( item const &it, unsigned int /* quantity */,
                         segment_bitset const &/* segments */ )
 {
-    const std::string item_health_option = get_option<std::string>( "ITEM_HEALTH" );
-    const bool show_bars = item_health_option == "both" || item_health_option == "bars";
+    const auto show_bars = []() {
+        const std::string item_health_option = get_option<std::string>( "ITEM_HEALTH" );
+        return item_health_option == "both" || item_health_option == "bars";
+    };
     if( !it.is_null() &&
         ( it.damage() != 0 || ( it.degradation() > 0 && it.degradation() >= it.max_damage() / 5 ) ||
-          ( show_bars && it.is_armor() ) ) ) {
+          ( it.is_armor() && show_bars() ) ) ) {
         return it.durability_indicator();
     }
     return {};
@@ -108,7 +110,8 @@ std::string wheel_diameter( item const &it, unsigned int /* quantity */,
 std::string burn( item const &it, unsigned int /* quantity */,
                   segment_bitset const &/* segments */ )
 {
-    if( !it.made_of_from_type( phase_id::LIQUID ) ) {
+    // volume() has to look at all the contents, so don't bother with it for unburnt items
+    if( it.burnt > 0 && !it.made_of_from_type( phase_id::LIQUID ) ) {
         if( it.volume() >= 1_liter && it.burnt * 125_ml >= it.volume() ) {
             return pgettext( "burnt adjective", "badly burnt " );
         }
@@ -1,7 +1,15 @@
 #include "json_loader.h"
 
+#include <algorithm>
+#include <deque>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <ghc/fs_std_fwd.hpp>
 
@@ -43,6 +51,7 @@ flexbuffer_cache &user_cache()
 }
 
 std::unordered_map<std::string, std::unique_ptr<flexbuffer_cache>> save_caches;
+std::mutex save_caches_mutex;
 
 // There's no measurable need to persist flatbuffers for save data, so just create a per-world 'cache' which parses
 // but doesn't disk-cache the parsed flatbuffer.
@@ -58,6 +67,7 @@ flexbuffer_cache &cache_for_save( const cata_path &path )
     std::string folder_or_file = path_it->u8string();
     ++path_it;
 
+    std::lock_guard<std::mutex> lock( save_caches_mutex );
     auto it = save_caches.find( worldname_str );
     if( it == save_caches.end() ) {
         it = save_caches.emplace( worldname_str,
@@ -113,6 +123,27 @@ std::optional<JsonValue> from_path_at_offset_opt_impl( const cata_path &source_f
     return JsonValue( std::move( buffer ), buffer_root, nullptr, 0 );
 }
 
+// The cache of a snapshot of the files, or nullptr if they aren't all in one disk cached folder.
+flexbuffer_cache *snapshot_cache( const std::vector<cata_path> &source_files,
+                                  std::vector<fs::path> &lexically_normal_paths )
+{
+    if( source_files.empty() ) {
+        return nullptr;
+    }
+    const cata_path::root_path root = source_files.front().get_logical_root();
+    if( root == cata_path::root_path::unknown || root == cata_path::root_path::save ) {
+        return nullptr;
+    }
+    lexically_normal_paths.reserve( source_files.size() );
+    for( const cata_path &source_file : source_files ) {
+        if( source_file.get_logical_root() != root ) {
+            return nullptr;
+        }
+        lexically_normal_paths.emplace_back( source_file.lexically_normal().get_unrelative_path() );
+    }
+    return &cache_for_lexically_normal_path( source_files.front().lexically_normal() );
+}
+
 } // namespace
 
 std::optional<JsonValue> json_loader::from_path_at_offset_opt( const cata_path &source_file,
@@ -151,6 +182,38 @@ JsonValue json_loader::from_path( const cata_path &source_file ) noexcept( false
     return from_path_at_offset( source_file, 0 );
 }
 
+void json_loader::for_each_from_paths( const std::vector<cata_path> &source_files,
+                                       const file_callback &load )
+{
+    // Parsing a file doesn't depend on anything loaded before it, so files are parsed
+    // (and flexbuffer cached) ahead on worker threads while this thread loads them in order.
+    const size_t parse_ahead = std::max( 1U, std::thread::hardware_concurrency() );
+    std::deque<std::future<JsonValue>> parsed_files;
+    size_t next_to_parse = 0;
+    bool use_threads = true;
+    for( const cata_path &file : source_files ) {
+        while( next_to_parse < source_files.size() && parsed_files.size() < parse_ahead ) {
+            const cata_path &next = source_files[next_to_parse++];
+            const auto parse = [&next]() {
+                return json_loader::from_path( next );
+            };
+            if( use_threads ) {
+                try {
+                    parsed_files.emplace_back( std::async( std::launch::async, parse ) );
+                    continue;
+                } catch( const std::system_error & ) {
+                    // No threads (e.g. the emscripten build), parse on this thread when needed.
+                    use_threads = false;
+                }
+            }
+            parsed_files.emplace_back( std::async( std::launch::deferred, parse ) );
+        }
+        std::future<JsonValue> parsed = std::move( parsed_files.front() );
+        parsed_files.pop_front();
+        load( file, parsed.get() );
+    }
+}
+
 JsonValue json_loader::from_string( std::string const &data ) noexcept( false )
 {
     std::shared_ptr<parsed_flexbuffer> buffer = flexbuffer_cache::parse_buffer( data );
@@ -172,3 +235,33 @@ std::optional<JsonValue> json_loader::from_string_opt( std::string const &data )
     }
     return ret;
 }
+
+std::optional<std::vector<JsonValue>> json_loader::from_snapshot(
+                                       const std::vector<cata_path> &source_files )
+{
+    std::vector<fs::path> lexically_normal_paths;
+    flexbuffer_cache *cache = snapshot_cache( source_files, lexically_normal_paths );
+    if( !cache ) {
+        return std::nullopt;
+    }
+    std::vector<std::shared_ptr<parsed_flexbuffer>> buffers = cache->load_snapshot(
+                lexically_normal_paths );
+    if( buffers.empty() ) {
+        return std::nullopt;
+    }
+    std::vector<JsonValue> ret;
+    ret.reserve( buffers.size() );
+    for( std::shared_ptr<parsed_flexbuffer> &buffer : buffers ) {
+        flexbuffers::Reference buffer_root = flexbuffer_root_from_storage( buffer->get_storage() );
+        ret.emplace_back( std::move( buffer ), buffer_root, nullptr, 0 );
+    }
+    return ret;
+}
+
+void json_loader::save_snapshot( const std::vector<cata_path> &source_files )
+{
+    std::vector<fs::path> lexically_normal_paths;
+    if( flexbuffer_cache *cache = snapshot_cache( source_files, lexically_normal_paths ) ) {
+        cache->save_snapshot( lexically_normal_paths );
+    }
+}
@@ -2,6 +2,10 @@
 #ifndef CATA_SRC_JSON_LOADER_H
 #define CATA_SRC_JSON_LOADER_H
 
+#include <functional>
+#include <optional>
+#include <vector>
+
 #include <ghc/fs_std_fwd.hpp>
 
 #include "path_info.h"
@@ -22,10 +26,26 @@ class json_loader
         static std::optional<JsonValue> from_path_at_offset_opt( const cata_path &source_file,
                 size_t offset = 0 ) noexcept( false );
 
+        // Calls load with each of the files, as json_loader::from_path would give it, in order.
+        // The next files are parsed on worker threads meanwhile, or on this thread when they're
+        // needed if no threads can be started.  Parse errors are thrown from here in file order.
+        using file_callback = std::function<void( const cata_path &, const JsonValue & )>;
+        static void for_each_from_paths( const std::vector<cata_path> &source_files,
+                                         const file_callback &load ) noexcept( false );
+
         // Like json_loader::from_path, except instead of parsing data from a file, will parse data from a string in memory.
         static JsonValue from_string( std::string const &data ) noexcept( false );
         static std::optional<JsonValue> from_string_opt( std::string const &data ) noexcept( false );
 
+        // Like json_loader::from_path for each of the files, but all of them come from one
+        // snapshot of their parsed json.  Returns nothing if there's no snapshot of exactly these
+        // files as they are now, or if they aren't all in the same disk cached folder.
+        static std::optional<std::vector<JsonValue>> from_snapshot(
+                    const std::vector<cata_path> &source_files );
+        // Saves a snapshot of the files for json_loader::from_snapshot.  They must all have been
+        // loaded with json_loader::from_path before.
+        static void save_snapshot( const std::vector<cata_path> &source_files );
+
 };
 
 #endif // CATA_SRC_JSON_LOADER_H
@@ -0,0 +1,92 @@
+#pragma once
+#ifndef CATA_SRC_LOS_CACHE_H
+#define CATA_SRC_LOS_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "point.h"
+
+/**
+ * Fixed size cache of line of sight results, keyed by a pair of points packed into
+ * a point (see map::sees_cache_key).
+ *
+ * It's an open addressing table over a flat array, so neither lookups nor inserts
+ * allocate (except for the array itself on first use). Clearing only bumps a
+ * generation counter, entries of older generations count as empty. When all slots
+ * a key may go to are taken, one of them is overwritten, so old results simply
+ * get lost once the cache fills up.
+ */
+class los_cache
+{
+    public:
+        /** Returns the cached value for @p key, or @p default_ if there is none. */
+        char get( const point &key, char default_ ) const {
+            if( entries.empty() ) {
+                return default_;
+            }
+            size_t index = home_slot( key );
+            for( int probe = 0; probe < max_probes; ++probe ) {
+                const entry &e = entries[index];
+                if( e.generation != generation ) {
+                    return default_;
+                }
+                if( e.key == key ) {
+                    return e.value;
+                }
+                index = ( index + 1 ) & ( num_slots - 1 );
+            }
+            return default_;
+        }
+
+        void insert( const point &key, const char value ) {
+            if( entries.empty() ) {
+                entries.resize( num_slots );
+            }
+            const size_t home = home_slot( key );
+            size_t index = home;
+            for( int probe = 0; probe < max_probes; ++probe ) {
+                entry &e = entries[index];
+                if( e.generation != generation || e.key == key ) {
+                    e = { key, generation, value };
+                    return;
+                }
+                index = ( index + 1 ) & ( num_slots - 1 );
+            }
+            // No free slot nearby, replacing an entry keeps the probe sequences of others intact
+            entries[home] = { key, generation, value };
+        }
+
+        void clear() {
+            generation++;
+            if( generation == 0 ) {
+                // Wrapped around, entries from the distant past would look current again
+                entries.assign( entries.size(), entry() );
+                generation = 1;
+            }
+        }
+
+    private:
+        struct entry {
+            point key;
+            uint32_t generation = 0;
+            char value = 0;
+        };
+
+        static constexpr size_t slot_bits = 17;
+        static constexpr size_t num_slots = size_t( 1 ) << slot_bits;
+        static constexpr int max_probes = 8;
+
+        static size_t home_slot( const point &key ) {
+            const uint64_t packed = static_cast<uint64_t>( static_cast<uint32_t>( key.x ) ) << 32 |
+                                    static_cast<uint32_t>( key.y );
+            // Fibonacci hashing, the high bits of the product are well mixed
+            return static_cast<size_t>( ( packed * 0x9E3779B97F4A7C15ULL ) >> ( 64 - slot_bits ) );
+        }
+
+        std::vector<entry> entries;
+        uint32_t generation = 1;
+};
+
+#endif // CATA_SRC_LOS_CACHE_H
@@ -421,10 +421,7 @@ std::set<tripoint> spell_effect::spell_effect_line( const override_parameters &p
     return result;
 }
 
-// spells do not reduce in damage the further away from the epicenter the targets are
-// rather they do their full damage in the entire area of effect
-std::set<tripoint> calculate_spell_effect_area( const spell &sp, const tripoint &target,
-        const Creature &caster )
+tripoint spell_effect_epicenter( const spell &sp, const tripoint &target, const Creature &caster )
 {
     // the actual target that the spell will hit.
     tripoint epicenter( target );
@@ -443,6 +440,15 @@ std::set<tripoint> calculate_spell_effect_area( const spell &sp, const tripoint
             }
         }
     }
+    return epicenter;
+}
+
+// spells do not reduce in damage the further away from the epicenter the targets are
+// rather they do their full damage in the entire area of effect
+std::set<tripoint> calculate_spell_effect_area( const spell &sp, const tripoint &target,
+        const Creature &caster )
+{
+    const tripoint epicenter = spell_effect_epicenter( sp, target, caster );
 
     std::set<tripoint> targets = { epicenter }; // initialize with epicenter
     if( sp.aoe( caster ) < 1 && sp.shape() != spell_shape::line ) {
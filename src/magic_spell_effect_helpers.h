@@ -9,6 +9,9 @@ class Creature;
 class spell;
 struct tripoint;
 
+// the point a spell aimed at target centers on, short of the first wall if it has a projectile
+tripoint spell_effect_epicenter( const spell &sp, const tripoint &target, const Creature &caster );
+
 // spells do not reduce in damage the further away from the epicenter the targets are
 // rather they do their full damage in the entire area of effect
 std::set<tripoint> calculate_spell_effect_area( const spell &sp, const tripoint &target,
@@ -347,6 +347,16 @@ cli_opts parse_commandline( int argc, const char **argv )
                     return 0;
                 }
             },
+            {
+                "--data-snapshot", {},
+                "Loads each data folder from one snapshot of its parsed json files",
+                section_default,
+                0,
+                []( int, const char ** ) -> int {
+                    data_snapshot = true;
+                    return 0;
+                }
+            },
             {
                 "--world", "<name>",
                 "Load world",
@@ -92,6 +92,7 @@
 #include "tileray.h"
 #include "translations.h"
 #include "trap.h"
+#include "turn_profiler.h"
 #include "ui_manager.h"
 #include "units.h"
 #include "value_ptr.h"
@@ -426,6 +427,31 @@ void map::add_vehicle_to_cache( vehicle *veh )
     }
 }
 
+void map::move_vehicle_in_cache( vehicle &veh, const std::vector<tripoint> &old_points )
+{
+    // Entries at the points the vehicle still covers get overwritten in place, only the
+    // ones it left have to be removed.
+    std::vector<tripoint> new_points;
+    for( const vpart_reference &vpr : veh.get_all_parts_with_fakes() ) {
+        if( vpr.part().removed ) {
+            continue;
+        }
+        const tripoint p = veh.global_part_pos3( vpr.part() );
+        level_cache &ch = get_cache( p.z );
+        ch.set_veh_cached_parts( p, veh, static_cast<int>( vpr.part_index() ) );
+        if( inbounds( p ) ) {
+            ch.set_veh_exists_at( p, true );
+        }
+        new_points.push_back( p );
+    }
+    std::sort( new_points.begin(), new_points.end() );
+    for( const tripoint &p : old_points ) {
+        if( !std::binary_search( new_points.begin(), new_points.end(), p ) ) {
+            clear_vehicle_point_from_cache( &veh, p );
+        }
+    }
+}
+
 void map::clear_vehicle_point_from_cache( vehicle *veh, const tripoint &pt )
 {
     if( veh == nullptr ) {
@@ -588,6 +614,7 @@ void map::on_vehicle_moved( const int smz )
 
 void map::vehmove()
 {
+    CATA_PROFILE_ZONE( "map::vehmove" );
     // give vehicles movement points
     VehicleList vehicle_list;
     int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z();
@@ -1421,7 +1448,7 @@ bool map::displace_vehicle( vehicle &veh, const tripoint &dp, const bool adjust_
     // first, let's find our position in current vehicles vector
     size_t our_i = 0;
     bool found = false;
-    for( submap *&smap : grid ) {
+    const auto find_in_submap = [&]( submap * smap ) {
         for( size_t i = 0; i < smap->vehicles.size(); i++ ) {
             if( smap->vehicles[i].get() == &veh ) {
                 our_i = i;
@@ -1430,9 +1457,19 @@ bool map::displace_vehicle( vehicle &veh, const tripoint &dp, const bool adjust_
                 break;
             }
         }
+    };
+    // The vehicle should be stored in the submap it thinks it is on, only search the
+    // whole map if it isn't (or if that submap isn't even on this map any more)
+    if( inbounds( sm_to_ms_copy( veh.sm_pos ) ) ) {
+        if( submap *const own_submap = get_submap_at_grid( veh.sm_pos ) ) {
+            find_in_submap( own_submap );
+        }
+    }
+    for( submap *smap : grid ) {
         if( found ) {
             break;
         }
+        find_in_submap( smap );
     }
 
     if( !found ) {
@@ -1525,8 +1562,9 @@ bool map::displace_vehicle( vehicle &veh, const tripoint &dp, const bool adjust_
     }
 
     veh.shed_loose_parts( trinary::SOME, &dst );
+    std::vector<tripoint> old_points;
     smzs = veh.advance_precalc_mounts( dst_offset, src.raw(), dp, ramp_offset,
-                                       adjust_pos, parts_to_move );
+                                       adjust_pos, parts_to_move, old_points );
     veh.update_active_fakes();
 
     if( src_submap != dst_submap ) {
@@ -1537,10 +1575,10 @@ bool map::displace_vehicle( vehicle &veh, const tripoint &dp, const bool adjust_
         src_submap->vehicles.erase( src_submap_veh_it );
         invalidate_max_populated_zlev( dst.z() );
     }
+    move_vehicle_in_cache( veh, old_points );
     if( need_update ) {
         g->update_map( player_character );
     }
-    add_vehicle_to_cache( &veh );
 
     if( z_change || src.z() != dst.z() ) {
         if( z_change ) {
@@ -5539,6 +5577,7 @@ static void process_vehicle_items( vehicle &cur_veh, int part )
 
 void map::process_items()
 {
+    CATA_PROFILE_ZONE( "map::process_items" );
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z();
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z();
     for( int gz = minz; gz <= maxz; ++gz ) {
@@ -7276,7 +7315,7 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
 {
     bool ( map::*f_transparent )( const tripoint & p ) const =
         with_fields ? &map::is_transparent : &map::is_transparent_wo_fields;
-    lru_cache_t &skew_cache = with_fields ? skew_vision_cache : skew_vision_wo_fields_cache;
+    los_cache &skew_cache = with_fields ? skew_vision_cache : skew_vision_wo_fields_cache;
     if( std::abs( F.z - T.z ) > fov_3d_z_range ||
         ( range >= 0 && range < rl_dist( F, T ) ) ||
         !inbounds( T ) ) {
@@ -7304,7 +7343,7 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
             }
             return true;
         } );
-        skew_cache.insert( 100000, key, visible ? 1 : 0 );
+        skew_cache.insert( key, visible ? 1 : 0 );
         return visible;
     }
 
@@ -7337,7 +7376,7 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         last_point = new_point;
         return true;
     } );
-    skew_cache.insert( 100000, key, visible ? 1 : 0 );
+    skew_cache.insert( key, visible ? 1 : 0 );
     return visible;
 }
 
@@ -7846,6 +7885,19 @@ void map::shift_traps( const tripoint &shift )
     }
 }
 
+// All bits of the MULTIPLIER columns from first_column on, in a cache made of SIZE rows
+template<int SIZE, int MULTIPLIER>
+static std::bitset<SIZE *SIZE> bitset_cache_columns( const size_t first_column )
+{
+    std::bitset<SIZE *SIZE> columns;
+    for( size_t y = 0; y < SIZE; ++y ) {
+        for( size_t x = 0; x < MULTIPLIER; ++x ) {
+            columns.set( y * SIZE + first_column + x );
+        }
+    }
+    return columns;
+}
+
 template<int SIZE, int MULTIPLIER>
 void shift_bitset_cache( std::bitset<SIZE *SIZE> &cache, const point &s )
 {
@@ -7858,16 +7910,15 @@ void shift_bitset_cache( std::bitset<SIZE *SIZE> &cache, const point &s )
     }
     // Shifting in the y direction shifted in 0 values, no no additional clearing is necessary, but
     // a shift in the x direction makes values "wrap" to the next row, and they need to be zeroed.
+    // Masking them out works on whole words, instead of one bit at a time.
     if( s.x == 0 ) {
         return;
     }
-    const size_t x_offset = s.x > 0 ? SIZE - MULTIPLIER : 0;
-    for( size_t y = 0; y < SIZE; ++y ) {
-        size_t y_offset = y * SIZE;
-        for( size_t x = 0; x < MULTIPLIER; ++x ) {
-            cache.reset( y_offset + x_offset + x );
-        }
-    }
+    static const std::bitset<SIZE *SIZE> keep_all_but_east =
+        ~bitset_cache_columns<SIZE, MULTIPLIER>( SIZE - MULTIPLIER );
+    static const std::bitset<SIZE *SIZE> keep_all_but_west =
+        ~bitset_cache_columns<SIZE, MULTIPLIER>( 0 );
+    cache &= s.x > 0 ? keep_all_but_east : keep_all_but_west;
 }
 
 template void
@@ -7926,80 +7977,31 @@ void map::shift( const point &sp )
             shift_bitset_cache<MAPSIZE_X, SEEX>( cache->map_memory_cache_ter, sp );
             shift_bitset_cache<MAPSIZE, 1>( cache->field_cache, sp );
         }
-        if( sp.x >= 0 ) {
-            for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
-                if( sp.y >= 0 ) {
-                    for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
-                        const tripoint grid( gridx, gridy, gridz );
-                        if( gridx + sp.x < my_MAPSIZE && gridy + sp.y < my_MAPSIZE ) {
-                            copy_grid( grid, grid + sp );
-                            submap *const cur_submap = get_submap_at_grid( grid );
-                            if( cur_submap == nullptr ) {
-                                debugmsg( "Tried to update vehicle list at %s but the submap is not loaded", grid.to_string() );
-                                continue;
-                            }
-                            update_vehicle_list( cur_submap, gridz );
-                        } else {
-                            loadn( grid, true );
-                            loaded_grids.emplace_back( grid );
-                        }
-                    }
-                } else { // sy < 0; work through it backwards
-                    for( int gridy = my_MAPSIZE - 1; gridy >= 0; gridy-- ) {
-                        const tripoint grid( gridx, gridy, gridz );
-                        if( gridx + sp.x < my_MAPSIZE && gridy + sp.y >= 0 ) {
-                            copy_grid( grid, grid + sp );
-                            submap *const cur_submap = get_submap_at_grid( grid );
-                            if( cur_submap == nullptr ) {
-                                debugmsg( "Tried to update vehicle list at %s but the submap is not loaded", grid.to_string() );
-                                continue;
-                            }
-                            update_vehicle_list( cur_submap, gridz );
-                        } else {
-                            loadn( grid, true );
-                            loaded_grids.emplace_back( grid );
-                        }
-                    }
-                }
-            }
-        } else { // sx < 0; work through it backwards
-            for( int gridx = my_MAPSIZE - 1; gridx >= 0; gridx-- ) {
-                if( sp.y >= 0 ) {
-                    for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
-                        const tripoint grid( gridx, gridy, gridz );
-                        if( gridx + sp.x >= 0 && gridy + sp.y < my_MAPSIZE ) {
-                            copy_grid( grid, grid + sp );
-                            submap *const cur_submap = get_submap_at_grid( grid );
-                            if( cur_submap == nullptr ) {
-                                debugmsg( "Tried to update vehicle list at %s but the submap is not loaded", grid.to_string() );
-                                continue;
-                            }
-                            update_vehicle_list( cur_submap, gridz );
-                        } else {
-                            loadn( grid, true );
-                            loaded_grids.emplace_back( grid );
-                        }
-                    }
-                } else { // sy < 0; work through it backwards
-                    for( int gridy = my_MAPSIZE - 1; gridy >= 0; gridy-- ) {
-                        const tripoint grid( gridx, gridy, gridz );
-                        if( gridx + sp.x >= 0 && gridy + sp.y >= 0 ) {
-                            copy_grid( grid, grid + sp );
-                            submap *const cur_submap = get_submap_at_grid( grid );
-                            if( cur_submap == nullptr ) {
-                                debugmsg( "Tried to update vehicle list at %s but the submap is not loaded", grid.to_string() );
-                                continue;
-                            }
-                            update_vehicle_list( cur_submap, gridz );
-                        } else {
-                            loadn( grid, true );
-                            loaded_grids.emplace_back( grid );
-                        }
+        // Walk the grid against the direction of the shift, so each submap gets moved before
+        // its old place is overwritten.
+        const int x_begin = sp.x >= 0 ? 0 : my_MAPSIZE - 1;
+        const int y_begin = sp.y >= 0 ? 0 : my_MAPSIZE - 1;
+        const int x_step = sp.x >= 0 ? 1 : -1;
+        const int y_step = sp.y >= 0 ? 1 : -1;
+        for( int gridx = x_begin; gridx >= 0 && gridx < my_MAPSIZE; gridx += x_step ) {
+            for( int gridy = y_begin; gridy >= 0 && gridy < my_MAPSIZE; gridy += y_step ) {
+                const tripoint grid( gridx, gridy, gridz );
+                const point from = grid.xy() + sp;
+                if( from.x >= 0 && from.x < my_MAPSIZE && from.y >= 0 && from.y < my_MAPSIZE ) {
+                    copy_grid( grid, grid + sp );
+                    submap *const cur_submap = get_submap_at_grid( grid );
+                    if( cur_submap == nullptr ) {
+                        debugmsg( "Tried to update vehicle list at %s but the submap is not loaded",
+                                  grid.to_string() );
+                        continue;
                     }
+                    update_vehicle_list( cur_submap, gridz );
+                } else {
+                    loadn( grid, true );
+                    loaded_grids.emplace_back( grid );
                 }
             }
         }
-
     }
     rebuild_vehicle_level_caches();
 
@@ -8108,6 +8110,24 @@ bool generate_uniform_omt( const tripoint_abs_sm &p, const oter_id &terrain_type
     return ret;
 }
 
+bool generate_omt( const tripoint_abs_omt &p, const time_point &when )
+{
+    // Each overmap square is two nonants; to prevent overlap, generate only at
+    //  squares divisible by 2.
+    const tripoint_abs_sm p_sm = project_to<coords::sm>( p );
+    const oter_id terrain_type = overmap_buffer.ter( p );
+
+    // Short-circuit if the map tile is uniform
+    // TODO: Replace with json mapgen functions.
+    if( generate_uniform_omt( p_sm, terrain_type ) ) {
+        return false;
+    }
+    tinymap tmp_map;
+    tmp_map.main_cleanup_override( false );
+    tmp_map.generate( p_sm, when );
+    return tmp_map.is_main_cleanup_queued();
+}
+
 void map::loadn( const tripoint &grid, const bool update_vehicles )
 {
     dbg( D_INFO ) << "map::loadn(game[" << g.get() << "], worldx[" << abs_sub.x()
@@ -8129,21 +8149,9 @@ void map::loadn( const tripoint &grid, const bool update_vehicles )
         // It doesn't exist; we must generate it!
         dbg( D_INFO | D_WARNING ) << "map::loadn: Missing mapbuffer data.  Regenerating.";
 
-        // Each overmap square is two nonants; to prevent overlap, generate only at
-        //  squares divisible by 2.
-        const tripoint_abs_omt grid_abs_omt = project_to<coords::omt>( grid_abs_sub );
-        const tripoint_abs_sm grid_abs_sub_rounded = project_to<coords::sm>( grid_abs_omt );
-
-        const oter_id terrain_type = overmap_buffer.ter( grid_abs_omt );
-
-        // Short-circuit if the map tile is uniform
-        // TODO: Replace with json mapgen functions.
-        if( !generate_uniform_omt( grid_abs_sub_rounded, terrain_type ) ) {
-            tinymap tmp_map;
-            tmp_map.main_cleanup_override( false );
-            tmp_map.generate( grid_abs_sub_rounded, calendar::turn );
-            _main_requires_cleanup |= main_inbounds && tmp_map.is_main_cleanup_queued();
-        }
+        const bool cleanup_queued = generate_omt( project_to<coords::omt>( grid_abs_sub ),
+                                    calendar::turn );
+        _main_requires_cleanup |= main_inbounds && cleanup_queued;
 
         // This is the same call to MAPBUFFER as above!
         tmpsub = MAPBUFFER.lookup_submap( grid_abs_sub );
@@ -9443,6 +9451,7 @@ void map::do_vehicle_caching( int z )
 
 void map::build_map_cache( const int zlev, bool skip_lightmap )
 {
+    CATA_PROFILE_ZONE( "map::build_map_cache" );
     const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
     const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
     bool seen_cache_dirty = false;
@@ -35,7 +35,7 @@
 #include "level_cache.h"
 #include "lightmap.h"
 #include "line.h"
-#include "lru_cache.h"
+#include "los_cache.h"
 #include "map_selector.h"
 #include "mapdata.h"
 #include "maptile_fwd.h"
@@ -707,6 +707,8 @@ class map
         VehicleList get_vehicles();
         void add_vehicle_to_cache( vehicle * );
         void clear_vehicle_point_from_cache( vehicle *veh, const tripoint &pt );
+        // Updates the caches of a displaced vehicle, old_points are the points it covered before
+        void move_vehicle_in_cache( vehicle &veh, const std::vector<tripoint> &old_points );
         // clears all vehicle level caches
         void clear_vehicle_level_caches();
         void remove_vehicle_from_cache( vehicle *veh, int zmin = -OVERMAP_DEPTH,
@@ -2268,9 +2270,8 @@ class map
         /**
          * Cache of coordinate pairs recently checked for visibility.
          */
-        using lru_cache_t = lru_cache<point, char>;
-        mutable lru_cache_t skew_vision_cache;
-        mutable lru_cache_t skew_vision_wo_fields_cache;
+        mutable los_cache skew_vision_cache;
+        mutable los_cache skew_vision_wo_fields_cache;
 
         // Note: no bounds check
         level_cache &get_cache( int zlev ) const {
@@ -2380,6 +2381,12 @@ void shift_bitset_cache( std::bitset<SIZE *SIZE> &cache, const point &s );
 bool ter_furn_has_flag( const ter_t &ter, const furn_t &furn, ter_furn_flag flag );
 bool generate_uniform( const tripoint_abs_sm &p, const oter_id &oter );
 bool generate_uniform_omt( const tripoint_abs_sm &p, const oter_id &terrain_type );
+/**
+ * Generates the overmap terrain at @p p (a single z-level) and stores its submaps in the
+ * map buffer. The submaps must not exist yet.
+ * @returns Whether the generated map queued a cleanup of the main map.
+ */
+bool generate_omt( const tripoint_abs_omt &p, const time_point &when );
 
 class tinymap : private map
 {
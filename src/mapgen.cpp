@@ -159,6 +159,8 @@ static const vproto_id vehicle_prototype_shopping_cart( "shopping_cart" );
 
 static constexpr int MON_RADIUS = 3;
 
+bool mapgen_use_terrain_rasters = true;
+
 static void science_room( map *m, const point &p1, const point &p2, int z, int rotate );
 
 // (x,y,z) are absolute coordinates of a submap
@@ -392,6 +394,17 @@ class mapgen_basic_container
             }
             return result;
         }
+
+        size_t terrain_raster_objects() const {
+            size_t result = 0;
+            for( const weighted_object<int, std::shared_ptr<mapgen_function>> &p : weights_ ) {
+                if( const mapgen_function_json_base *json =
+                        dynamic_cast<const mapgen_function_json_base *>( p.obj.get() ) ) {
+                    result += json->get_objects().get_terrain_raster_objects();
+                }
+            }
+            return result;
+        }
 };
 
 class mapgen_factory
@@ -1472,6 +1485,13 @@ class mapgen_value
         Id get( const mapgendata &dat ) const {
             return source_->get( dat );
         }
+        /** The value, if it is the same no matter the parameters and random rolls */
+        std::optional<Id> get_if_constant() const {
+            if( const id_source *source = dynamic_cast<const id_source *>( source_.get() ) ) {
+                return source->id;
+            }
+            return std::nullopt;
+        }
         std::vector<StringId> all_possible_results( const mapgen_parameters &params ) const {
             return source_->all_possible_results( params );
         }
@@ -2846,7 +2866,19 @@ class jmapgen_terrain : public jmapgen_piece
             if( chosen_id.id().is_null() ) {
                 return;
             }
-            point p( x.get(), y.get() );
+            place( dat, point( x.get(), y.get() ), chosen_id, context );
+        }
+
+        std::optional<ter_id> fixed_terrain() const override {
+            if( is_nop() ) {
+                return std::nullopt;
+            }
+            return id.get_if_constant();
+        }
+
+        /** Places (non-null) terrain @p chosen_id at @p p, as a terrain piece would. */
+        static void place( const mapgendata &dat, const point &p, const ter_id &chosen_id,
+                           const std::string &context ) {
             tripoint tp( p, dat.m.get_abs_sub().z() );
 
             ter_id terrain_here = dat.m.ter( p );
@@ -4696,6 +4728,47 @@ std::unordered_set<point> nested_mapgen::all_placement_coords() const
 void jmapgen_objects::finalize()
 {
     std::stable_sort( objects.begin(), objects.end(), compare_phases );
+    build_terrain_raster();
+}
+
+void jmapgen_objects::build_terrain_raster()
+{
+    terrain_raster.clear();
+    terrain_raster_objects = 0;
+    if( mapgensize.x <= 0 || mapgensize.y <= 0 ) {
+        return;
+    }
+    const auto range_at_phase = std::equal_range( objects.begin(), objects.end(),
+                                mapgen_phase::terrain, compare_phases );
+    // The raster is applied in row major order. Only take objects that are in that order
+    // (as those from "rows" are) and don't overlap, so the terrain gets placed in the same
+    // order as before and anything that depends on the order (like random numbers drawn
+    // by the terrain) stays the same.
+    int last_index = -1;
+    for( auto it = range_at_phase.first; it != range_at_phase.second; ++it ) {
+        const jmapgen_place &where = it->first;
+        const jmapgen_piece &what = *it->second;
+        if( where.x.val != where.x.valmax || where.y.val != where.y.valmax ||
+            where.repeat.val != 1 || where.repeat.valmax != 1 ||
+            what.repeat.val != 1 || what.repeat.valmax != 1 ) {
+            break;
+        }
+        const std::optional<ter_id> ter = what.fixed_terrain();
+        const point p( where.x.val, where.y.val );
+        if( !ter || p.x < 0 || p.y < 0 || p.x >= mapgensize.x || p.y >= mapgensize.y ) {
+            break;
+        }
+        const int index = p.y * mapgensize.x + p.x;
+        if( index <= last_index ) {
+            break;
+        }
+        if( terrain_raster.empty() ) {
+            terrain_raster.resize( static_cast<size_t>( mapgensize.x ) * mapgensize.y, t_null );
+        }
+        terrain_raster[index] = *ter;
+        last_index = index;
+        terrain_raster_objects++;
+    }
 }
 
 void jmapgen_objects::check( const std::string &context, const mapgen_parameters &parameters ) const
@@ -5206,6 +5279,19 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase,
     apply( dat, phase, point_zero, context );
 }
 
+void jmapgen_objects::apply_terrain_raster( const mapgendata &dat, const point &offset,
+        const std::string &context ) const
+{
+    const ter_id *cell = terrain_raster.data();
+    for( int y = 0; y < mapgensize.y; y++ ) {
+        for( int x = 0; x < mapgensize.x; x++, cell++ ) {
+            if( *cell != t_null ) {
+                jmapgen_terrain::place( dat, point( x, y ) + offset, *cell, context );
+            }
+        }
+    }
+}
+
 void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase, const point &offset,
                              const std::string &context ) const
 {
@@ -5213,6 +5299,12 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase, const po
 
     auto range_at_phase = std::equal_range( objects.begin(), objects.end(), phase, compare_phases );
 
+    if( phase == mapgen_phase::terrain && terrain_raster_objects > 0 &&
+        mapgen_use_terrain_rasters ) {
+        apply_terrain_raster( dat, offset, context );
+        range_at_phase.first += terrain_raster_objects;
+    }
+
     for( auto it = range_at_phase.first; it != range_at_phase.second; ++it ) {
         const jmapgen_obj &obj = *it;
         jmapgen_place where = obj.first;
@@ -7922,6 +8014,12 @@ bool has_mapgen_for( const std::string &key )
     return oter_mapgen.has( key );
 }
 
+size_t mapgen_terrain_raster_objects( const std::string &key )
+{
+    const mapgen_basic_container *container = oter_mapgen.find( key );
+    return container ? container->terrain_raster_objects() : 0;
+}
+
 bool has_update_mapgen_for( const update_mapgen_id &key )
 {
     return update_mapgens.count( key );
@@ -6,6 +6,7 @@
 #include <iosfwd>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -235,6 +236,13 @@ class jmapgen_piece
         /** Place something on the map from mapgendata &dat, at (x,y). */
         virtual void apply( const mapgendata &dat, const jmapgen_int &x, const jmapgen_int &y,
                             const std::string &context ) const = 0;
+        /**
+         * The terrain this piece places, if it places terrain and nothing else, and always the
+         * same one. Such pieces can be baked into a terrain raster, see @ref jmapgen_objects.
+         */
+        virtual std::optional<ter_id> fixed_terrain() const {
+            return std::nullopt;
+        }
         virtual ~jmapgen_piece() = default;
         jmapgen_int repeat;
         virtual bool has_vehicle_collision( const mapgendata &, const point &/*offset*/ ) const {
@@ -409,6 +417,10 @@ struct jmapgen_objects {
 
         void add_placement_coords_to( std::unordered_set<point> & ) const;
 
+        size_t get_terrain_raster_objects() const {
+            return terrain_raster_objects;
+        }
+
         void apply( const mapgendata &dat, mapgen_phase, const std::string &context ) const;
         void apply( const mapgendata &dat, mapgen_phase, const point &offset,
                     const std::string &context ) const;
@@ -428,6 +440,20 @@ struct jmapgen_objects {
         point m_offset;
         point mapgensize;
         point total_size;
+
+        /**
+         * Most terrain comes from the "rows" of a mapgen, one object per square, and the same
+         * every time. The leading objects of the terrain phase that place fixed terrain on a
+         * fixed square are baked into this raster (row major, t_null where they place nothing),
+         * so applying them doesn't need to go through each object and piece.
+         */
+        std::vector<ter_id> terrain_raster;
+        // How many objects at the start of the terrain phase the raster stands in for
+        size_t terrain_raster_objects = 0;
+
+        void build_terrain_raster();
+        void apply_terrain_raster( const mapgendata &dat, const point &offset,
+                                   const std::string &context ) const;
 };
 
 class mapgen_function_json_base
@@ -445,6 +471,10 @@ class mapgen_function_json_base
             return parameters;
         }
 
+        const jmapgen_objects &get_objects() const {
+            return objects;
+        }
+
     private:
         JsonObject jsobj;
     protected:
@@ -611,6 +641,17 @@ bool has_update_mapgen_for( const update_mapgen_id & );
  */
 void calculate_mapgen_weights(); // throws
 
+/**
+ * Whether json mapgen applies its precompiled terrain rasters. Only ever turned off to
+ * check that they give the same results as the objects they were compiled from.
+ */
+extern bool mapgen_use_terrain_rasters;
+/**
+ * How many objects the terrain rasters of the json mapgens for @p key stand in for, summed
+ * over all of them.
+ */
+size_t mapgen_terrain_raster_objects( const std::string &key );
+
 void check_mapgen_definitions();
 
 /// move to building_generation
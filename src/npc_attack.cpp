@@ -5,6 +5,7 @@
 #include "creature_tracker.h"
 #include "dialogue.h"
 #include "flag.h"
+#include "game.h"
 #include "item.h"
 #include "line.h"
 #include "magic.h"
@@ -118,9 +119,10 @@ npc_attack_rating npc_attack_spell::evaluate( const npc &source,
     }
     const int time_penalty = base_time_penalty( source );
     const std::vector<tripoint> targetable_points = attack_spell.targetable_locations( source );
+    const std::optional<std::vector<tripoint>> creatures = creatures_in_reach( source );
     for( const tripoint &targetable_point : targetable_points ) {
-        npc_attack_rating effectiveness_at_point = evaluate_tripoint(
-                    source, target, targetable_point );
+        npc_attack_rating effectiveness_at_point = evaluate_tripoint_pruned(
+                    source, target, targetable_point, creatures );
         effectiveness_at_point -= time_penalty;
         if( effectiveness_at_point > effectiveness ) {
             effectiveness = effectiveness_at_point;
@@ -139,9 +141,10 @@ std::vector<npc_attack_rating> npc_attack_spell::all_evaluations( const npc &sou
     }
     int time_penalty = this->base_time_penalty( source );
     const std::vector<tripoint> targetable_points = attack_spell.targetable_locations( source );
+    const std::optional<std::vector<tripoint>> creatures = creatures_in_reach( source );
     for( const tripoint &targetable_point : targetable_points ) {
-        npc_attack_rating effectiveness_at_point = evaluate_tripoint(
-                    source, target, targetable_point );
+        npc_attack_rating effectiveness_at_point = evaluate_tripoint_pruned(
+                    source, target, targetable_point, creatures );
         effectiveness_at_point -= time_penalty;
         effectiveness.push_back( effectiveness_at_point );
     }
@@ -170,6 +173,50 @@ int npc_attack_spell::base_time_penalty( const npc &source ) const
     return time_penalty;
 }
 
+std::optional<std::vector<tripoint>> npc_attack_spell::creatures_in_reach( const npc &source ) const
+{
+    const spell &attack_spell = source.magic->get_spell( attack_spell_id );
+    // Only blasts have an area that is bounded by their aoe around the target point. Fields
+    // rate empty points too, and a random aoe would draw a different radius for every point.
+    if( attack_spell.shape() != spell_shape::blast || attack_spell_id->field ||
+        attack_spell.has_flag( spell_flag::RANDOM_AOE ) || attack_spell.aoe( source ) < 1 ) {
+        return std::nullopt;
+    }
+    const int reach = attack_spell.range( source ) + attack_spell.aoe( source );
+    const std::vector<Creature *> in_reach = g->get_creatures_if( [&]( const Creature & critter ) {
+        return square_dist( critter.pos().xy(), source.pos().xy() ) <= reach;
+    } );
+    std::vector<tripoint> result;
+    result.reserve( in_reach.size() );
+    for( const Creature *critter : in_reach ) {
+        result.push_back( critter->pos() );
+    }
+    return result;
+}
+
+npc_attack_rating npc_attack_spell::evaluate_tripoint_pruned( const npc &source,
+        const Creature *target, const tripoint &location,
+        const std::optional<std::vector<tripoint>> &creatures ) const
+{
+    if( !creatures ) {
+        return evaluate_tripoint( source, target, location );
+    }
+    const spell &attack_spell = source.magic->get_spell( attack_spell_id );
+    const int aoe = attack_spell.aoe( source );
+    // A blast with a projectile stops short of the first wall in its way, which may be right
+    // next to us or an ally
+    const tripoint epicenter = spell_effect_epicenter( attack_spell, location, source );
+    for( const tripoint &critter_pos : *creatures ) {
+        if( ( critter_pos.z == location.z && square_dist( critter_pos, location ) <= aoe ) ||
+            ( critter_pos.z == epicenter.z && square_dist( critter_pos, epicenter ) <= aoe ) ) {
+            return evaluate_tripoint( source, target, location );
+        }
+    }
+    // The area is a subset of the points within aoe of the location or the epicenter, nobody to
+    // hit there
+    return npc_attack_rating( 0, location );
+}
+
 npc_attack_rating npc_attack_spell::evaluate_tripoint(
     const npc &source, const Creature *target, const tripoint &location ) const
 {
@@ -63,6 +63,7 @@ class npc_attack
 class npc_attack_spell : public npc_attack
 {
         const spell_id attack_spell_id;
+        friend class npc_attack_spell_test_helper;
     public:
         explicit npc_attack_spell( const spell_id &attack_spell_id ) : attack_spell_id( attack_spell_id ) {}
         npc_attack_rating evaluate( const npc &source, const Creature *target ) const override;
@@ -74,6 +75,19 @@ class npc_attack_spell : public npc_attack
         int base_time_penalty( const npc &source ) const;
         npc_attack_rating evaluate_tripoint(
             const npc &source, const Creature *target, const tripoint &location ) const;
+        /**
+         * Positions of the creatures the spell could hit from any of its targetable points,
+         * or nullopt if the spell's area can't be bounded (see evaluate_tripoint_pruned).
+         */
+        std::optional<std::vector<tripoint>> creatures_in_reach( const npc &source ) const;
+        /**
+         * Same as evaluate_tripoint, but skips calculating the area of points that can't hit
+         * any of the creatures from creatures_in_reach, as those rate 0.  Both the location and
+         * the epicenter the spell would stop at are checked.
+         */
+        npc_attack_rating evaluate_tripoint_pruned( const npc &source, const Creature *target,
+                const tripoint &location,
+                const std::optional<std::vector<tripoint>> &creatures ) const;
 };
 
 class npc_attack_melee : public npc_attack
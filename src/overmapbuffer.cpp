@@ -41,6 +41,7 @@
 #include "simple_pathfinding.h"
 #include "string_formatter.h"
 #include "translations.h"
+#include "turn_profiler.h"
 #include "vehicle.h"
 
 class map_extra;
@@ -595,6 +596,7 @@ void overmapbuffer::process_mongroups()
 
 void overmapbuffer::move_hordes()
 {
+    CATA_PROFILE_ZONE( "overmapbuffer::move_hordes" );
     // arbitrary radius to include nearby overmaps (aside from the current one)
     const int radius = MAPSIZE * 2;
     const tripoint_abs_sm center = get_player_character().global_sm_location();
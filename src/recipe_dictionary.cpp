@@ -85,29 +85,6 @@ const recipe &recipe_dictionary::get_craft( const itype_id &id )
     return iter != recipe_dict.recipes.end() ? iter->second : null_recipe;
 }
 
-// searches for left-anchored partial match in the relevant recipe requirements set
-template <class group>
-bool search_reqs( const group &gp, const std::string_view txt )
-{
-    return std::any_of( gp.begin(), gp.end(), [&]( const typename group::value_type & opts ) {
-        return std::any_of( opts.begin(),
-        opts.end(), [&]( const typename group::value_type::value_type & e ) {
-            return lcmatch( e.to_string(), txt );
-        } );
-    } );
-}
-// template specialization to make component searches easier
-template<>
-bool search_reqs( const std::vector<std::vector<item_comp> > &gp,
-                  const std::string_view txt )
-{
-    return std::any_of( gp.begin(), gp.end(), [&]( const std::vector<item_comp> &opts ) {
-        return std::any_of( opts.begin(), opts.end(), [&]( const item_comp & ic ) {
-            return lcmatch( item::nname( ic.type ), txt );
-        } );
-    } );
-}
-
 std::vector<const recipe *> recipe_subset::favorite() const
 {
     std::vector<const recipe *> res;
@@ -165,10 +142,45 @@ std::vector<const recipe *> recipe_subset::recent() const
     return res;
 }
 
+// collects the recipes of every indexed requirement whose text matches the query
+template <class index, class to_text>
+static void search_index( const index &idx, const std::string_view txt, to_text text_of,
+                          std::unordered_set<const recipe *> &matches )
+{
+    for( const auto &entry : idx ) {
+        if( lcmatch( text_of( entry.first ), txt ) ) {
+            matches.insert( entry.second.begin(), entry.second.end() );
+        }
+    }
+}
+
 std::vector<const recipe *> recipe_subset::search(
     const std::string_view txt, const search_type key,
     const std::function<void( size_t, size_t )> &progress_callback ) const
 {
+    // Requirement searches match the text of each distinct requirement once via the recipe
+    // dictionary index, rather than formatting the requirements of every recipe in the subset.
+    std::unordered_set<const recipe *> indexed_matches;
+    switch( key ) {
+        case search_type::component:
+            search_index( recipe_dict.recipes_by_component(), txt, []( const itype_id & type ) {
+                return item::nname( type );
+            }, indexed_matches );
+            break;
+        case search_type::tool:
+            search_index( recipe_dict.recipes_by_tool(), txt, []( const tool_comp & tool ) {
+                return tool.to_string();
+            }, indexed_matches );
+            break;
+        case search_type::quality:
+            search_index( recipe_dict.recipes_by_quality(), txt, []( const quality_requirement & qual ) {
+                return qual.to_string();
+            }, indexed_matches );
+            break;
+        default:
+            break;
+    }
+
     auto predicate = [&]( const recipe * r ) {
         if( !*r || r->obsolete ) {
             return false;
@@ -194,13 +206,9 @@ std::vector<const recipe *> recipe_subset::search(
                 return lcmatch( r->skill_used->name(), txt );
 
             case search_type::component:
-                return search_reqs( r->simple_requirements().get_components(), txt );
-
             case search_type::tool:
-                return search_reqs( r->simple_requirements().get_tools(), txt );
-
             case search_type::quality:
-                return search_reqs( r->simple_requirements().get_qualities(), txt );
+                return indexed_matches.count( r ) > 0;
 
             case search_type::quality_result: {
                 return item::find_type( r->result() )->has_any_quality( txt );
@@ -640,6 +648,35 @@ void recipe_dictionary::finalize()
     }
 
     recipe_dict.find_items_on_loops();
+
+    recipe_dict.index_requirements( recipe_dict.recipes );
+    recipe_dict.index_requirements( recipe_dict.uncraft );
+}
+
+void recipe_dictionary::index_requirements( const std::map<recipe_id, recipe> &obj )
+{
+    for( const auto &e : obj ) {
+        const recipe &r = e.second;
+        if( r.obsolete ) {
+            continue;
+        }
+        const requirement_data &reqs = r.simple_requirements();
+        for( const std::vector<item_comp> &opts : reqs.get_components() ) {
+            for( const item_comp &comp : opts ) {
+                by_component[comp.type].insert( &r );
+            }
+        }
+        for( const std::vector<tool_comp> &opts : reqs.get_tools() ) {
+            for( const tool_comp &tool : opts ) {
+                by_tool[tool].insert( &r );
+            }
+        }
+        for( const std::vector<quality_requirement> &opts : reqs.get_qualities() ) {
+            for( const quality_requirement &qual : opts ) {
+                by_quality[qual].insert( &r );
+            }
+        }
+    }
 }
 
 void recipe_dictionary::check_consistency()
@@ -690,6 +727,9 @@ void recipe_dictionary::reset()
     recipe_dict.recipes.clear();
     recipe_dict.uncraft.clear();
     recipe_dict.items_on_loops.clear();
+    recipe_dict.by_component.clear();
+    recipe_dict.by_tool.clear();
+    recipe_dict.by_quality.clear();
 }
 
 void recipe_dictionary::delete_if( const std::function<bool( const recipe & )> &pred )
@@ -42,6 +42,21 @@ class recipe_dictionary
 
         std::map<recipe_id, const recipe *> find_obsoletes( const itype_id &item_id ) const;
 
+        /**
+         * Recipes indexed by each component, tool and quality requirement they list (see
+         * @ref recipe::simple_requirements). Built once in @ref finalize so that searches
+         * only need to match the text of each distinct requirement instead of every recipe's.
+         */
+        const std::map<itype_id, std::set<const recipe *>> &recipes_by_component() const {
+            return by_component;
+        }
+        const std::map<tool_comp, std::set<const recipe *>> &recipes_by_tool() const {
+            return by_tool;
+        }
+        const std::map<quality_requirement, std::set<const recipe *>> &recipes_by_quality() const {
+            return by_quality;
+        }
+
         size_t size() const;
         std::map<recipe_id, recipe>::const_iterator begin() const;
         std::map<recipe_id, recipe>::const_iterator end() const;
@@ -80,9 +95,13 @@ class recipe_dictionary
         std::set<const recipe *> blueprints;
         std::map<const itype_id, const recipe *> obsoletes;
         std::unordered_set<itype_id> items_on_loops;
+        std::map<itype_id, std::set<const recipe *>> by_component;
+        std::map<tool_comp, std::set<const recipe *>> by_tool;
+        std::map<quality_requirement, std::set<const recipe *>> by_quality;
 
         static void finalize_internal( std::map<recipe_id, recipe> &obj );
         void find_items_on_loops();
+        void index_requirements( const std::map<recipe_id, recipe> &obj );
 };
 
 extern recipe_dictionary recipe_dict;
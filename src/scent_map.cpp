@@ -1,6 +1,7 @@
 #include "scent_map.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdlib>
 #include <new>
 
@@ -82,14 +83,34 @@ void scent_map::draw( const catacurses::window &win, const int div, const tripoi
 
 void scent_map::shift( const point &sm_shift )
 {
-    scent_array<int> new_scent;
-    for( size_t x = 0; x < MAPSIZE_X; ++x ) {
-        for( size_t y = 0; y < MAPSIZE_Y; ++y ) {
-            const point p = point( x, y ) + sm_shift;
-            new_scent[x][y] = inbounds( p ) ? grscent[ p.x ][ p.y ] : 0;
+    // Shifts in place, a column (which is contiguous) at a time. Columns are visited in the
+    // direction of the shift, so none is overwritten before it has been moved.
+    const int y_count = std::max( MAPSIZE_Y - std::abs( sm_shift.y ), 0 );
+    const auto shift_column = [&]( const int x ) {
+        std::array<int, MAPSIZE_Y> &to = grscent[x];
+        const int from_x = x + sm_shift.x;
+        if( from_x < 0 || from_x >= MAPSIZE_X || y_count == 0 ) {
+            to.fill( 0 );
+            return;
+        }
+        const std::array<int, MAPSIZE_Y> &from = grscent[from_x];
+        if( sm_shift.y >= 0 ) {
+            std::copy( from.begin() + sm_shift.y, from.begin() + sm_shift.y + y_count, to.begin() );
+            std::fill( to.begin() + y_count, to.end(), 0 );
+        } else {
+            std::copy_backward( from.begin(), from.begin() + y_count, to.end() );
+            std::fill( to.begin(), to.end() - y_count, 0 );
+        }
+    };
+    if( sm_shift.x > 0 ) {
+        for( int x = 0; x < MAPSIZE_X; ++x ) {
+            shift_column( x );
+        }
+    } else {
+        for( int x = MAPSIZE_X - 1; x >= 0; --x ) {
+            shift_column( x );
         }
     }
-    grscent = new_scent;
 }
 
 int scent_map::get( const tripoint &p ) const
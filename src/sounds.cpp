@@ -1,6 +1,7 @@
 #include "sounds.h"
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
@@ -11,6 +12,7 @@
 #include "activity_type.h"
 #include "cached_options.h" // IWYU pragma: keep
 #include "calendar.h"
+#include "cata_utility.h"
 #include "character.h"
 #include "coordinate_conversions.h"
 #include "coordinates.h"
@@ -38,6 +40,7 @@
 #include "string_formatter.h"
 #include "translations.h"
 #include "trap.h"
+#include "turn_profiler.h"
 #include "type_id.h"
 #include "uistate.h"
 #include "units.h"
@@ -469,10 +472,91 @@ static int get_signal_for_hordes( const centroid &centr )
     return 0;
 }
 
+namespace
+{
+// Monsters in the reality bubble binned by the submap they are on, so sound clusters only
+// have to look at monsters that are close enough to possibly hear them.
+class monster_hearing_grid
+{
+    public:
+        // Monsters may have been spawned, killed or moved since the grid was built, it is
+        // rebuilt on the next query.
+        void set_dirty() {
+            dirty = true;
+        }
+
+        // Calls func for every living monster within range (horizontally) of source, in the
+        // same order as g->all_monsters().
+        template<typename Func>
+        void for_each_near( const tripoint &source, int range, Func func ) {
+            if( dirty ) {
+                rebuild();
+            }
+            if( monsters.empty() || range < 0 ) {
+                return;
+            }
+            const point lo = bin_of( source.xy() - point( range, range ) );
+            const point hi = bin_of( source.xy() + point( range, range ) );
+            if( lo == point_zero && hi == point( MAPSIZE - 1, MAPSIZE - 1 ) ) {
+                for( monster *critter : monsters ) {
+                    if( !critter->is_dead() ) {
+                        func( *critter );
+                    }
+                }
+                return;
+            }
+            candidates.clear();
+            for( int x = lo.x; x <= hi.x; x++ ) {
+                for( int y = lo.y; y <= hi.y; y++ ) {
+                    candidates.insert( candidates.end(), bins[x][y].begin(), bins[x][y].end() );
+                }
+            }
+            std::sort( candidates.begin(), candidates.end() );
+            for( size_t index : candidates ) {
+                if( !monsters[index]->is_dead() ) {
+                    func( *monsters[index] );
+                }
+            }
+        }
+
+    private:
+        void rebuild() {
+            monsters.clear();
+            for( std::array<std::vector<size_t>, MAPSIZE> &column_bins : bins ) {
+                for( std::vector<size_t> &bin : column_bins ) {
+                    bin.clear();
+                }
+            }
+            for( monster &critter : g->all_monsters() ) {
+                const point sm = bin_of( critter.pos().xy() );
+                bins[sm.x][sm.y].push_back( monsters.size() );
+                monsters.push_back( &critter );
+            }
+            dirty = false;
+        }
+
+        static point bin_of( const point &p ) {
+            // Clamp in tiles first, so huge ranges can't overflow the division
+            return point( clamp( p.x, 0, MAPSIZE_X - 1 ) / SEEX,
+                          clamp( p.y, 0, MAPSIZE_Y - 1 ) / SEEY );
+        }
+
+        std::vector<monster *> monsters;
+        std::array<std::array<std::vector<size_t>, MAPSIZE>, MAPSIZE> bins;
+        std::vector<size_t> candidates;
+        bool dirty = true;
+};
+} // namespace
+
 void sounds::process_sounds()
 {
+    CATA_PROFILE_ZONE( "sounds::process_sounds" );
     std::vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
+    if( sound_clusters.empty() ) {
+        return;
+    }
     const int weather_vol = get_weather().weather_id->sound_attn;
+    monster_hearing_grid hearing_grid;
     for( const centroid &this_centroid : sound_clusters ) {
         // Since monsters don't go deaf ATM we can just use the weather modified volume
         // If they later get physical effects from loud noises we'll have to change this
@@ -491,14 +575,16 @@ void sounds::process_sounds()
             overmap_buffer.signal_hordes( target, sig_power );
         }
         // Alert all monsters (that can hear) to the sound.
-        for( monster &critter : g->all_monsters() ) {
+        // The horizontal part of sound_distance alone is at least the square distance,
+        // so monsters further away than that can't hear it.
+        hearing_grid.for_each_near( source, vol * 2 - 1, [&]( monster & critter ) {
             // TODO: Generalize this to Creature::hear_sound
             const int dist = sound_distance( source, critter.pos() );
             if( vol * 2 > dist ) {
                 // Exclude monsters that certainly won't hear the sound
                 critter.hear_sound( source, vol, dist, this_centroid.provocative );
             }
-        }
+        } );
         // Trigger sound-triggered traps and ensure they are still valid
         for( const trap *trapType : trap::get_sound_triggered_traps() ) {
             for( const tripoint &tp : get_map().trap_locations( trapType->id ) ) {
@@ -508,6 +594,8 @@ void sounds::process_sounds()
                 if( vol * 2 > dist ) {
                     if( tr.triggered_by_sound( vol, dist ) ) {
                         tr.trigger( tp );
+                        // The trap may have spawned, killed or moved monsters
+                        hearing_grid.set_dirty();
                     }
                 }
             }
@@ -1,11 +1,25 @@
+#include <array>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
+#include "debug.h"
 #include "string_id.h"
 
 namespace
 {
 using InternMapType = std::unordered_map<std::string, int>;
-using ReverseLookupVecType = std::vector<const std::string *>;
+
+// Strings can be interned on several threads at once (the consistency checks run in parallel),
+// while other threads look up strings interned before.  The reverse lookup is read without
+// locking, so it's stored in chunks that never move once they are allocated.
+constexpr size_t reverse_lookup_chunk_size = 4096;
+constexpr size_t reverse_lookup_max_chunks = 16384;
+
+struct ReverseLookupType {
+    std::array<std::unique_ptr<const std::string *[]>, reverse_lookup_max_chunks> chunks;
+    size_t size = 0;
+};
 } // namespace
 
 static InternMapType &get_intern_map()
@@ -14,19 +28,37 @@ static InternMapType &get_intern_map()
     return map;
 }
 
-static ReverseLookupVecType &get_reverse_lookup_vec()
+static ReverseLookupType &get_reverse_lookup()
+{
+    static ReverseLookupType lookup{};
+    return lookup;
+}
+
+static std::mutex &get_intern_mutex()
 {
-    static ReverseLookupVecType vec{};
-    return vec;
+    static std::mutex intern_mutex;
+    return intern_mutex;
 }
 
 template<typename S>
 static int universal_string_id_intern( S &&s )
 {
-    int next_id = get_reverse_lookup_vec().size();
-    const auto &pair = get_intern_map().emplace( std::forward<S>( s ), next_id );
+    std::lock_guard<std::mutex> lock( get_intern_mutex() );
+    ReverseLookupType &reverse_lookup = get_reverse_lookup();
+    const size_t next_id = reverse_lookup.size;
+    const auto &pair = get_intern_map().emplace( std::forward<S>( s ),
+                        static_cast<int>( next_id ) );
     if( pair.second ) { // inserted
-        get_reverse_lookup_vec().push_back( &pair.first->first );
+        const size_t chunk = next_id / reverse_lookup_chunk_size;
+        if( chunk >= reverse_lookup_max_chunks ) {
+            cata_fatal( "Too many interned strings" );
+        }
+        if( !reverse_lookup.chunks[chunk] ) {
+            reverse_lookup.chunks[chunk] = std::make_unique<const std::string *[]>
+                                           ( reverse_lookup_chunk_size );
+        }
+        reverse_lookup.chunks[chunk][next_id % reverse_lookup_chunk_size] = &pair.first->first;
+        ++reverse_lookup.size;
     }
     return pair.first->second;
 }
@@ -48,7 +80,9 @@ int string_identity_static::string_id_intern( std::string &&s )
 
 const std::string &string_identity_static::get_interned_string( int id )
 {
-    return *get_reverse_lookup_vec()[id];
+    const size_t index = id;
+    return *get_reverse_lookup().chunks[index / reverse_lookup_chunk_size][index %
+            reverse_lookup_chunk_size];
 }
 
 int string_identity_static::empty_interned_string()
@@ -0,0 +1,184 @@
+#include "turn_profiler.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "cata_utility.h"
+#include "json.h"
+
+namespace
+{
+
+struct trace_event {
+    const char *name;
+    std::chrono::steady_clock::time_point start;
+    turn_profiler::duration length;
+};
+
+struct profiler_state {
+    bool running = false;
+    // Incremented by each start(), so zones that were open during it are ignored
+    int run = 0;
+    int depth = 0;
+    int turns = 0;
+    // Whether any zone was completed since the last end_turn()
+    bool turn_has_zones = false;
+    std::chrono::steady_clock::time_point epoch;
+    std::vector<turn_profiler::zone_stats> stats;
+    // Zone names are string literals, so views of them stay valid
+    std::unordered_map<std::string_view, size_t> stats_index;
+    // Time spent in each zone of stats during the current turn
+    std::vector<turn_profiler::duration> this_turn;
+    std::vector<trace_event> events;
+};
+
+// Past this many events only the totals are updated, so a forgotten profiler can't eat all memory
+constexpr size_t max_trace_events = 1000000;
+
+profiler_state &get_state()
+{
+    static profiler_state state;
+    return state;
+}
+
+size_t find_or_add_stats( const char *name, const int depth )
+{
+    profiler_state &state = get_state();
+    auto iter = state.stats_index.find( name );
+    if( iter == state.stats_index.end() ) {
+        iter = state.stats_index.emplace( name, state.stats.size() ).first;
+        turn_profiler::zone_stats new_stats;
+        new_stats.name = name;
+        new_stats.depth = depth;
+        state.stats.emplace_back( std::move( new_stats ) );
+        state.this_turn.emplace_back( turn_profiler::duration::zero() );
+    }
+    return iter->second;
+}
+
+} // namespace
+
+namespace turn_profiler
+{
+
+bool is_compiled_in()
+{
+#if defined(CATA_PROFILER)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool is_running()
+{
+    return get_state().running;
+}
+
+void start()
+{
+    profiler_state &state = get_state();
+    const int run = state.run + 1;
+    state = profiler_state();
+    state.run = run;
+    state.running = true;
+    state.epoch = std::chrono::steady_clock::now();
+}
+
+void stop()
+{
+    // Only count the turn in progress if something was recorded in it, do_turn usually
+    // has just ended the turn
+    if( get_state().turn_has_zones ) {
+        end_turn();
+    }
+    get_state().running = false;
+}
+
+void end_turn()
+{
+    profiler_state &state = get_state();
+    if( !state.running ) {
+        return;
+    }
+    for( size_t i = 0; i < state.stats.size(); ++i ) {
+        state.stats[i].max_per_turn = std::max( state.stats[i].max_per_turn, state.this_turn[i] );
+        state.this_turn[i] = duration::zero();
+    }
+    state.turns++;
+    state.turn_has_zones = false;
+}
+
+int recorded_turns()
+{
+    return get_state().turns;
+}
+
+std::vector<zone_stats> get_stats()
+{
+    return get_state().stats;
+}
+
+bool write_trace( const std::string &path )
+{
+    const profiler_state &state = get_state();
+    return write_to_file( path, [&state]( std::ostream & fout ) {
+        JsonOut jsout( fout );
+        jsout.start_object();
+        jsout.member( "displayTimeUnit", "ms" );
+        jsout.member( "traceEvents" );
+        jsout.start_array();
+        for( const trace_event &event : state.events ) {
+            using micros = std::chrono::duration<double, std::micro>;
+            jsout.start_object();
+            jsout.member( "name", event.name );
+            jsout.member( "ph", "X" );
+            jsout.member( "ts", micros( event.start - state.epoch ).count() );
+            jsout.member( "dur", micros( event.length ).count() );
+            jsout.member( "pid", 0 );
+            jsout.member( "tid", 0 );
+            jsout.end_object();
+        }
+        jsout.end_array();
+        jsout.end_object();
+    }, "turn profile" );
+}
+
+zone::zone( const char *name ) : name( name ), active( get_state().running )
+{
+    if( active ) {
+        profiler_state &state = get_state();
+        // Registered here rather than on completion so that parents are listed before children
+        stats_index = find_or_add_stats( name, state.depth );
+        run = state.run;
+        state.depth++;
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+zone::~zone()
+{
+    if( !active ) {
+        return;
+    }
+    const duration length = std::chrono::steady_clock::now() - start;
+    profiler_state &state = get_state();
+    if( !state.running || state.run != run ) {
+        return;
+    }
+    state.depth--;
+    zone_stats &stats = state.stats[stats_index];
+    stats.count++;
+    stats.total += length;
+    state.this_turn[stats_index] += length;
+    state.turn_has_zones = true;
+    if( state.events.size() < max_trace_events ) {
+        state.events.push_back( { name, start, length } );
+    }
+}
+
+} // namespace turn_profiler
@@ -0,0 +1,81 @@
+#pragma once
+#ifndef CATA_SRC_TURN_PROFILER_H
+#define CATA_SRC_TURN_PROFILER_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Scoped timing of the stages of a game turn.
+ *
+ * Zones are only compiled in when building with CATA_PROFILER (PROFILER=1 with make,
+ * -DPROFILER=ON with CMake). Even then they only record something while the profiler
+ * is running, which is toggled from the debug menu.
+ *
+ * Recorded zones can be written in the Chrome trace event format, which can be opened
+ * in chrome://tracing or https://ui.perfetto.dev. Zones nest, so a zone opened inside
+ * another one shows up as its child there.
+ */
+namespace turn_profiler
+{
+
+using duration = std::chrono::steady_clock::duration;
+
+/** Totals of one zone over all turns since the profiler was started. */
+struct zone_stats {
+    std::string name;
+    // Nesting depth of the zone when it was first recorded
+    int depth = 0;
+    int count = 0;
+    duration total = duration::zero();
+    // Longest time spent in this zone during a single turn
+    duration max_per_turn = duration::zero();
+};
+
+/** Whether zones are compiled in at all. */
+bool is_compiled_in();
+bool is_running();
+/** Forgets all previous data and starts recording zones. */
+void start();
+/** Stops recording, the recorded data stays available until the next start(). */
+void stop();
+/** Marks the end of a game turn, the per turn maxima are taken over the zones since the last call. */
+void end_turn();
+int recorded_turns();
+/** Totals of each zone, in the order they were first recorded. */
+std::vector<zone_stats> get_stats();
+/** Writes all recorded zones as Chrome trace events to the file at @p path. */
+bool write_trace( const std::string &path );
+
+class zone
+{
+    public:
+        explicit zone( const char *name );
+        ~zone();
+
+        zone( const zone & ) = delete;
+        zone &operator=( const zone & ) = delete;
+    private:
+        const char *name;
+        std::chrono::steady_clock::time_point start;
+        bool active;
+        // Index into the zone totals and the profiler run they belong to
+        size_t stats_index = 0;
+        int run = 0;
+};
+
+} // namespace turn_profiler
+
+#if defined(CATA_PROFILER)
+#define CATA_PROFILE_ZONE_CONCAT_IMPL( a, b ) a##b
+#define CATA_PROFILE_ZONE_CONCAT( a, b ) CATA_PROFILE_ZONE_CONCAT_IMPL( a, b )
+/** Times the rest of the enclosing scope as a zone named @p name (a string literal). */
+#define CATA_PROFILE_ZONE( name ) \
+    const turn_profiler::zone CATA_PROFILE_ZONE_CONCAT( profile_zone_, __LINE__ )( name )
+#else
+#define CATA_PROFILE_ZONE( name ) static_cast<void>( 0 )
+#endif
+
+#endif // CATA_SRC_TURN_PROFILER_H
@@ -8017,7 +8017,7 @@ std::vector<std::reference_wrapper<const vehicle_part>> vehicle::real_parts() co
 }
 std::set<int> vehicle::advance_precalc_mounts( const point &new_pos, const tripoint &src,
         const tripoint &dp, int ramp_offset, const bool adjust_pos,
-        std::set<int> parts_to_move )
+        std::set<int> parts_to_move, std::vector<tripoint> &old_points )
 {
     map &here = get_map();
     std::set<int> smzs;
@@ -8049,7 +8049,7 @@ std::set<int> vehicle::advance_precalc_mounts( const point &new_pos, const tripo
     for( vehicle_part &prt : parts ) {
         index += 1;
         if( prt.is_real_or_active_fake() ) {
-            here.clear_vehicle_point_from_cache( this, src + prt.precalc[0] );
+            old_points.push_back( src + prt.precalc[0] );
         }
         // no parts means this is a normal horizontal or vertical move
         if( parts_to_move.empty() ) {
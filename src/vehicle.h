@@ -2143,10 +2143,12 @@ class vehicle
         item removed_part( const vehicle_part &vp ) const;
 
         // Updates the internal precalculated mount offsets after the vehicle has been displaced
-        // used in map::displace_vehicle()
+        // used in map::displace_vehicle(). The points the parts covered before the move are
+        // appended to old_points, so the map can update its caches afterwards.
         std::set<int> advance_precalc_mounts( const point &new_pos, const tripoint &src,
                                               const tripoint &dp, int ramp_offset,
-                                              bool adjust_pos, std::set<int> parts_to_move );
+                                              bool adjust_pos, std::set<int> parts_to_move,
+                                              std::vector<tripoint> &old_points );
         // make sure the vehicle is supported across z-levels or on the same z-level
         bool level_vehicle();
 
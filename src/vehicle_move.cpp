@@ -868,6 +868,11 @@ veh_collision vehicle::part_collision( int part, const tripoint &p,
     if( !just_detect && coll_velocity == 0 ) {
         return ret;
     }
+    // Most tiles a vehicle moves into are flat and empty. Nothing below collides with flat
+    // terrain (move cost 2) unless bashing the floor, so skip the part and terrain lookups.
+    if( !is_body_collision && !bash_floor && here.move_cost_ter_furn( p ) == 2 ) {
+        return ret;
+    }
 
     if( is_body_collision ) {
         // critters on a BOARDABLE part in this vehicle aren't colliding
@@ -0,0 +1,2 @@
+// NOLINT(cata-header-guard)
+#define VERSION "0e5a6e4"
@@ -154,7 +154,14 @@ bool inventory::has_quality( const quality_id &qual, int level, int qty ) const
 {
     const quality_query query{ qual, level, qty };
 
+    // Rebinning resets the cached results, so make sure they aren't stale.
+    get_binned_items();
     if( qualities_cache.find( query ) == qualities_cache.end() ) {
+        if( max_quality( qual ) < level ) {
+            // Nothing in here provides the quality at the requested level
+            qualities_cache[query] = false;
+            return false;
+        }
         int res = 0;
         for( const auto &stack : this->items ) {
             res += stack.size() * has_quality_internal( stack.front(), qual, level, qty );
@@ -264,6 +271,20 @@ int read_only_visitable::max_quality( const quality_id &qual ) const
     return max_quality_internal( *this, qual );
 }
 
+/** @relates visitable */
+int inventory::max_quality( const quality_id &qual ) const
+{
+    // Rebinning resets the cached levels, so make sure they aren't stale.
+    get_binned_items();
+    const auto iter = max_quality_cache.find( qual );
+    if( iter != max_quality_cache.end() ) {
+        return iter->second;
+    }
+    const int res = max_quality_internal( *this, qual );
+    max_quality_cache.emplace( qual, res );
+    return res;
+}
+
 /** @relates visitable */
 int Character::max_quality( const quality_id &qual ) const
 {
@@ -616,6 +637,7 @@ std::list<item> inventory::remove_items_with( const
 
     // Invalidate binning cache
     binned = false;
+    stacks_by_type.invalidate();
 
     return res;
 }
@@ -905,9 +927,10 @@ int inventory::charges_of( const itype_id &what, int limit,
                            const std::function<void( int )> &visitor, bool in_tools ) const
 {
     const itype_bin &binned = get_binned_items();
-    const auto iter = std::find_if( binned.begin(),
-    binned.end(), [&what]( itype_bin::value_type const & it ) {
-        return it.first == what || ( what == itype_UPS && it.first->has_flag( flag_IS_UPS ) );
+    // Only UPS needs to look beyond the exact type, everything else is a hashed lookup.
+    const auto iter = what != itype_UPS ? binned.find( what ) : std::find_if( binned.begin(),
+    binned.end(), []( itype_bin::value_type const & it ) {
+        return it.first == itype_UPS || it.first->has_flag( flag_IS_UPS );
     } );
     if( iter == binned.end() ) {
         return 0;
@@ -1,4 +1,7 @@
+#include <algorithm>
 #include <iosfwd>
+#include <optional>
+#include <unordered_set>
 #include <vector>
 
 #include "activity_actor_definitions.h"
@@ -6,12 +9,15 @@
 #include "clzones.h"
 #include "item.h"
 #include "item_category.h"
+#include "map.h"
 #include "map_helpers.h"
 #include "player_helpers.h"
 #include "pocket_type.h"
 #include "point.h"
 #include "ret_val.h"
 #include "type_id.h"
+#include "vehicle.h"
+#include "vpart_position.h"
 
 static const activity_id ACT_MOVE_LOOT( "ACT_MOVE_LOOT" );
 static const faction_id faction_your_followers( "your_followers" );
@@ -59,8 +65,160 @@ void create_tile_zone( const std::string &name, const zone_type_id &zone_type, t
     zm.add( name, zone_type, faction_your_followers, false, true, pos, pos, nullptr, false, veh );
 }
 
+// The points of the zones of one type, the way zone_manager used to cache them
+struct zone_point_sets {
+    std::unordered_set<tripoint_abs_ms> points;
+    std::unordered_set<tripoint_abs_ms> vehicle_points;
+
+    void add( const tripoint_abs_ms &start, const tripoint_abs_ms &end ) {
+        for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>( start, end ) ) {
+            points.insert( p );
+        }
+    }
+
+    bool has( const tripoint_abs_ms &where ) const {
+        return points.count( where ) || vehicle_points.count( where );
+    }
+
+    std::unordered_set<tripoint_abs_ms> get_near( const tripoint_abs_ms &where, int range ) const {
+        std::unordered_set<tripoint_abs_ms> ret;
+        for( const tripoint_abs_ms &p : points ) {
+            if( square_dist( p, where ) <= range ) {
+                ret.insert( p );
+            }
+        }
+        for( const tripoint_abs_ms &p : vehicle_points ) {
+            if( p.z() == where.z() && square_dist( p, where ) <= range ) {
+                ret.insert( p );
+            }
+        }
+        return ret;
+    }
+
+    std::optional<int> nearest_dist( const tripoint_abs_ms &where, int range ) const {
+        std::optional<int> ret;
+        for( const std::unordered_set<tripoint_abs_ms> *set : {
+                 &points, &vehicle_points
+             } ) {
+            for( const tripoint_abs_ms &p : *set ) {
+                const int dist = square_dist( p, where );
+                if( dist <= range && ( !ret || dist < *ret ) ) {
+                    ret = dist;
+                }
+            }
+        }
+        return ret;
+    }
+
+    // Every point of every zone within radius, regardless of z-level
+    std::unordered_set<tripoint_abs_ms> get_all_near( const tripoint_abs_ms &where,
+            int radius ) const {
+        std::unordered_set<tripoint_abs_ms> ret;
+        for( const std::unordered_set<tripoint_abs_ms> *set : {
+                 &points, &vehicle_points
+             } ) {
+            for( const tripoint_abs_ms &p : *set ) {
+                if( square_dist( p, where ) <= radius ) {
+                    ret.insert( p );
+                }
+            }
+        }
+        return ret;
+    }
+};
+
 } // namespace
 
+TEST_CASE( "zone_queries_match_the_zone_points", "[zones]" )
+{
+    clear_avatar();
+    clear_map();
+    clear_vehicles();
+    map &here = get_map();
+    zone_manager &zm = zone_manager::get_manager();
+    const tripoint_abs_ms origin = here.getglobal( tripoint_zero );
+
+    zone_point_sets food;
+    zone_point_sets drink;
+    const auto add_zone = [&]( zone_point_sets & sets, const zone_type_id & type,
+    const tripoint & start, const tripoint & end ) {
+        zm.add( type.str(), type, faction_your_followers, false, true, ( origin + start ).raw(),
+                ( origin + end ).raw(), nullptr, false, true );
+        sets.add( origin + start, origin + end );
+    };
+    // Two overlapping zones, one of them on two z-levels
+    add_zone( food, zone_type_LOOT_FOOD, { 2, 2, 0 }, { 6, 5, 0 } );
+    add_zone( food, zone_type_LOOT_FOOD, { 4, 3, 0 }, { 9, 8, 1 } );
+    // A zone far out of the reality bubble
+    add_zone( food, zone_type_LOOT_FOOD, { 300, -40, 0 }, { 303, -38, 0 } );
+    // Another type, and a disabled zone that must be ignored
+    add_zone( drink, zone_type_LOOT_DRINK, { -5, -5, 0 }, { -3, -1, 0 } );
+    zm.add( "Disabled", zone_type_LOOT_FOOD, faction_your_followers, false, false,
+            ( origin + tripoint( -20, 0, 0 ) ).raw(), ( origin + tripoint( -18, 2, 0 ) ).raw(),
+            nullptr, false, true );
+
+    // A zone on a vehicle's cargo part
+    const tripoint veh_pos( 15, -6, 0 );
+    vehicle *veh = here.add_vehicle( vehicle_prototype_shopping_cart, veh_pos, 0_degrees, 0, 0 );
+    REQUIRE( veh != nullptr );
+    veh->set_owner( get_avatar() );
+    const std::optional<vpart_reference> cargo = here.veh_at( veh_pos ).cargo();
+    REQUIRE( cargo );
+    const tripoint_abs_ms veh_point = here.getglobal( cargo->pos() );
+    zm.add( "Cart", zone_type_LOOT_FOOD, faction_your_followers, false, true, veh_point.raw(),
+            veh_point.raw(), nullptr, false, true );
+    food.vehicle_points.insert( veh_point );
+    REQUIRE( zm.get_zone_at( veh_point ) != nullptr );
+    REQUIRE( zm.get_zone_at( veh_point )->get_is_vehicle() );
+
+    std::vector<tripoint_abs_ms> queries;
+    for( int x = -22; x <= 22; x += 3 ) {
+        for( int y = -10; y <= 12; y += 2 ) {
+            for( int z = -1; z <= 2; ++z ) {
+                queries.push_back( origin + tripoint( x, y, z ) );
+            }
+        }
+    }
+    queries.push_back( origin + tripoint( 301, -39, 0 ) );
+    queries.push_back( origin + tripoint( 400, 400, 0 ) );
+    queries.push_back( veh_point );
+
+    for( const tripoint_abs_ms &where : queries ) {
+        CAPTURE( where - origin );
+        CHECK( zm.has( zone_type_LOOT_FOOD, where ) == food.has( where ) );
+        CHECK( zm.has( zone_type_LOOT_DRINK, where ) == drink.has( where ) );
+        for( const int range : {
+                 0, 1, 3, 10, ACTIVITY_SEARCH_DISTANCE, 500
+             } ) {
+            CAPTURE( range );
+            const std::unordered_set<tripoint_abs_ms> near_food = food.get_near( where, range );
+            CHECK( zm.get_near( zone_type_LOOT_FOOD, where, range ) == near_food );
+            CHECK( zm.has_near( zone_type_LOOT_FOOD, where, range ) == !near_food.empty() );
+            CHECK( zm.get_near( zone_type_LOOT_DRINK, where, range ) ==
+                   drink.get_near( where, range ) );
+
+            const std::optional<tripoint_abs_ms> nearest =
+                zm.get_nearest( zone_type_LOOT_FOOD, where, range );
+            const std::optional<int> nearest_dist = food.nearest_dist( where, range );
+            REQUIRE( nearest.has_value() == nearest_dist.has_value() );
+            if( nearest ) {
+                CHECK( food.has( *nearest ) );
+                CHECK( square_dist( *nearest, where ) == *nearest_dist );
+            }
+
+            std::unordered_set<tripoint> loot;
+            for( const zone_point_sets *sets : {
+                     &food, &drink
+                 } ) {
+                for( const tripoint_abs_ms &p : sets->get_all_near( where, range ) ) {
+                    loot.insert( here.getlocal( p ) );
+                }
+            }
+            CHECK( zm.get_point_set_loot( where, range ) == loot );
+        }
+    }
+}
+
 TEST_CASE( "zone_unloading_ammo_belts", "[zones][items][ammo_belt][activities][unload]" )
 {
     avatar &dummy = get_avatar();
@@ -21,6 +21,7 @@
 #include "game.h"
 #include "inventory.h"
 #include "item.h"
+#include "item_components.h"
 #include "itype.h"
 #include "map.h"
 #include "map_helpers.h"
@@ -44,6 +45,7 @@
 
 static const activity_id ACT_CRAFT( "ACT_CRAFT" );
 
+static const flag_id json_flag_COOKED( "COOKED" );
 static const flag_id json_flag_ITEM_BROKEN( "ITEM_BROKEN" );
 static const flag_id json_flag_USE_UPS( "USE_UPS" );
 
@@ -151,6 +153,25 @@ TEST_CASE( "recipe_subset" )
                 CHECK( comp_recipes.size() == 1 );
                 CHECK( comp_recipes.find( r ) != comp_recipes.end() );
             }
+            THEN( "it can be found by its requirements" ) {
+                const std::vector<const recipe *> by_component = subset.search(
+                            item::nname( itype_water_clean ), recipe_subset::search_type::component );
+                CHECK( by_component == std::vector<const recipe *> { r } );
+
+                const requirement_data &reqs = r->simple_requirements();
+                for( const std::vector<tool_comp> &opts : reqs.get_tools() ) {
+                    const std::vector<const recipe *> by_tool = subset.search(
+                                opts.front().to_string(), recipe_subset::search_type::tool );
+                    CHECK( by_tool == std::vector<const recipe *> { r } );
+                }
+                for( const std::vector<quality_requirement> &opts : reqs.get_qualities() ) {
+                    const std::vector<const recipe *> by_quality = subset.search(
+                                opts.front().to_string(), recipe_subset::search_type::quality );
+                    CHECK( by_quality == std::vector<const recipe *> { r } );
+                }
+
+                CHECK( subset.search( "no such component", recipe_subset::search_type::component ).empty() );
+            }
             AND_WHEN( "the subset is cleared" ) {
                 subset.clear();
 
@@ -2392,3 +2413,33 @@ TEST_CASE( "pseudo_tools_in_crafting_inventory", "[crafting][tools]" )
         clear_map();
     }
 }
+
+TEST_CASE( "copied_item_components_change_independently", "[crafting][item]" )
+{
+    item original( itype_hammer );
+    item cotton( itype_sheet_cotton );
+    item thread( itype_thread );
+    original.components.add( cotton );
+    original.components.add( thread );
+    REQUIRE( original.components.size() == 2 );
+
+    item copy = original;
+    CHECK( copy.components.size() == 2 );
+
+    copy.set_flag_recursive( json_flag_COOKED );
+    copy.components.add( cotton );
+    CHECK( copy.components.size() == 3 );
+    CHECK( original.components.size() == 2 );
+    for( const item_components::type_vector_pair &tvp : std::as_const( original.components ) ) {
+        for( const item &component : tvp.second ) {
+            CHECK_FALSE( component.has_flag( json_flag_COOKED ) );
+        }
+    }
+
+    CHECK( copy.components.remove( itype_thread ).success() );
+    copy.components.clear();
+    CHECK( copy.components.empty() );
+    CHECK( original.components.size() == 2 );
+    CHECK( original.components.remove( itype_thread ).success() );
+    CHECK( original.components.size() == 1 );
+}
@@ -0,0 +1,42 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cata_catch.h"
+#include "debug.h"
+
+TEST_CASE( "debugmsgs_deferred_on_several_threads_are_replayed_in_order", "[debug]" )
+{
+    std::vector<deferred_debugmsg> first;
+    std::vector<deferred_debugmsg> second;
+    std::thread first_thread( [&first]() {
+        first = defer_debugmsgs_during( []() {
+            debugmsg( "first a" );
+            debugmsg( "first b" );
+        } );
+    } );
+    std::thread second_thread( [&second]() {
+        second = defer_debugmsgs_during( []() {
+            debugmsg( "second" );
+        } );
+    } );
+    first_thread.join();
+    second_thread.join();
+
+    REQUIRE( first.size() == 2 );
+    REQUIRE( second.size() == 1 );
+    CHECK( first[0].text == "first a" );
+    CHECK( first[1].text == "first b" );
+    CHECK( second[0].text == "second" );
+
+    // Nothing is deferred on this thread
+    CHECK( capture_debugmsg_during( []() {
+        debugmsg( "main" );
+    } ) == "main" );
+
+    const std::string replayed = capture_debugmsg_during( [&first, &second]() {
+        replay_deferred_debugmsgs( second );
+        replay_deferred_debugmsgs( first );
+    } );
+    CHECK( replayed == "secondfirst afirst b" );
+}
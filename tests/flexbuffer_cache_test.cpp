@@ -0,0 +1,170 @@
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ghc/fs_std.hpp>
+
+#include "cata_catch.h"
+#include "cata_scope_helpers.h"
+#include "flexbuffer_cache.h"
+#include "flexbuffer_json.h"
+
+namespace
+{
+struct snapshot_test_files {
+    fs::path root;
+    fs::path cache;
+    std::vector<fs::path> files;
+
+    snapshot_test_files() {
+        root = fs::temp_directory_path() / fs::u8path( "cata_flexbuffer_snapshot_test" );
+        cache = root / fs::u8path( "cache" );
+        fs::remove_all( root );
+        fs::create_directories( root / fs::u8path( "data" ) );
+        fs::create_directories( cache );
+        for( int i = 0; i < 3; ++i ) {
+            fs::path file = root / fs::u8path( "data" ) /
+                            fs::u8path( "f" + std::to_string( i ) + ".json" );
+            std::ofstream( file ) << R"([{"type":"test","id":"v)" << i << R"(","n":)" << i * 7 <<
+                                  "}]";
+            files.push_back( file );
+        }
+    }
+
+    // Parses and caches every file, then snapshots them
+    void save_snapshot() const {
+        flexbuffer_cache cache_for_save( cache, root );
+        for( const fs::path &file : files ) {
+            REQUIRE( cache_for_save.parse_and_cache( file ) );
+        }
+        REQUIRE( cache_for_save.save_snapshot( files ) );
+    }
+
+    // Loads the snapshot the way a later run would
+    std::vector<std::shared_ptr<parsed_flexbuffer>> load_snapshot() const {
+        flexbuffer_cache cache_for_load( cache, root );
+        return cache_for_load.load_snapshot( files );
+    }
+
+    fs::path snapshot_path() const {
+        std::vector<fs::path> snapshots;
+        const fs::path snapshots_dir = cache / fs::u8path( "snapshots" );
+        for( const fs::directory_entry &entry : fs::directory_iterator( snapshots_dir ) ) {
+            snapshots.push_back( entry.path() );
+        }
+        REQUIRE( snapshots.size() == 1 );
+        return snapshots.front();
+    }
+
+    std::vector<char> read_snapshot() const {
+        std::ifstream in( snapshot_path(), std::ifstream::binary );
+        return std::vector<char>( std::istreambuf_iterator<char>( in ),
+                                  std::istreambuf_iterator<char>() );
+    }
+
+    void write_snapshot( const std::vector<char> &contents ) const {
+        std::ofstream out( snapshot_path(), std::ofstream::binary | std::ofstream::trunc );
+        out.write( contents.data(), contents.size() );
+    }
+};
+} // namespace
+
+TEST_CASE( "flexbuffer_snapshot_round_trip", "[json]" )
+{
+    const snapshot_test_files test_files;
+    on_out_of_scope cleanup( [&]() {
+        fs::remove_all( test_files.root );
+    } );
+
+    CHECK( test_files.load_snapshot().empty() );
+    test_files.save_snapshot();
+
+    const std::vector<std::shared_ptr<parsed_flexbuffer>> loaded = test_files.load_snapshot();
+    REQUIRE( loaded.size() == test_files.files.size() );
+    for( size_t i = 0; i < loaded.size(); ++i ) {
+        CAPTURE( i );
+        CHECK_FALSE( loaded[i]->is_stale() );
+        CHECK( reinterpret_cast<uintptr_t>( loaded[i]->get_storage()->data() ) % 8 == 0 );
+        const flexbuffers::Map entry = flexbuffer_root_from_storage(
+                                           loaded[i]->get_storage() ).AsVector()[0].AsMap();
+        CHECK( entry["id"].AsString().str() == "v" + std::to_string( i ) );
+        CHECK( entry["n"].AsInt64() == static_cast<int64_t>( i * 7 ) );
+    }
+
+    // A snapshot is only for exactly the files it was taken of
+    const std::vector<fs::path> fewer_files( test_files.files.begin(), test_files.files.end() - 1 );
+    flexbuffer_cache cache( test_files.cache, test_files.root );
+    CHECK( cache.load_snapshot( fewer_files ).empty() );
+}
+
+TEST_CASE( "flexbuffer_snapshot_of_modified_file_is_not_loaded", "[json]" )
+{
+    const snapshot_test_files test_files;
+    on_out_of_scope cleanup( [&]() {
+        fs::remove_all( test_files.root );
+    } );
+    test_files.save_snapshot();
+    REQUIRE( test_files.load_snapshot().size() == test_files.files.size() );
+
+    const fs::path &modified = test_files.files[1];
+    fs::last_write_time( modified, fs::last_write_time( modified ) + std::chrono::seconds( 5 ) );
+    CHECK( test_files.load_snapshot().empty() );
+}
+
+TEST_CASE( "damaged_flexbuffer_snapshot_is_not_loaded", "[json]" )
+{
+    const snapshot_test_files test_files;
+    on_out_of_scope cleanup( [&]() {
+        fs::remove_all( test_files.root );
+    } );
+    test_files.save_snapshot();
+    const std::vector<char> intact = test_files.read_snapshot();
+    REQUIRE( intact.size() > 64 );
+    REQUIRE( test_files.load_snapshot().size() == test_files.files.size() );
+
+    SECTION( "truncated" ) {
+        const std::vector<size_t> sizes = { 0, 4, intact.size() / 2, intact.size() - 1 };
+        for( const size_t size : sizes ) {
+            CAPTURE( size );
+            test_files.write_snapshot( std::vector<char>( intact.begin(), intact.begin() + size ) );
+            CHECK( test_files.load_snapshot().empty() );
+        }
+    }
+
+    SECTION( "wrong magic" ) {
+        std::vector<char> damaged = intact;
+        damaged[0] = 'X';
+        test_files.write_snapshot( damaged );
+        CHECK( test_files.load_snapshot().empty() );
+    }
+
+    SECTION( "file table points past the end" ) {
+        // The last flexbuffer ends at the end of the file, so growing its size by one makes its
+        // table entry point out of bounds
+        std::vector<char> damaged = intact;
+        const size_t last_size = test_files.load_snapshot().back()->get_storage()->size();
+        const size_t last_offset = intact.size() - last_size;
+        bool found = false;
+        for( size_t at = 0; at + 2 * sizeof( uint64_t ) <= damaged.size();
+             at += sizeof( uint64_t ) ) {
+            uint64_t offset;
+            uint64_t size;
+            std::memcpy( &offset, damaged.data() + at, sizeof( offset ) );
+            std::memcpy( &size, damaged.data() + at + sizeof( offset ), sizeof( size ) );
+            if( offset == last_offset && size == last_size ) {
+                ++size;
+                std::memcpy( damaged.data() + at + sizeof( offset ), &size, sizeof( size ) );
+                found = true;
+                break;
+            }
+        }
+        REQUIRE( found );
+        test_files.write_snapshot( damaged );
+        CHECK( test_files.load_snapshot().empty() );
+    }
+}
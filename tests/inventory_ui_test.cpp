@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <vector>
+
+#include "cata_catch.h"
+#include "inventory_ui.h"
+#include "item.h"
+#include "item_location.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "type_id.h"
+
+static const itype_id itype_hammer( "hammer" );
+static const itype_id itype_pockknife( "pockknife" );
+
+namespace
+{
+class collating_preset : public inventory_selector_preset
+{
+    public:
+        collating_preset() {
+            _collate_entries = true;
+        }
+};
+} // namespace
+
+static bool always_yes( const inventory_entry & )
+{
+    return true;
+}
+
+// What find_by_location should give, searched entry by entry
+static inventory_entry *find_by_location_linearly( const inventory_column &col,
+        const item_location &loc )
+{
+    for( inventory_entry *entry : col.get_entries( always_yes, true ) ) {
+        if( std::find( entry->locations.begin(), entry->locations.end(), loc ) !=
+            entry->locations.end() ) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+// The visible entry a new entry for loc should be stacked into, searched entry by entry
+static inventory_entry *find_stack_linearly( const inventory_column &col,
+        const item_location &loc )
+{
+    for( inventory_entry *entry : col.get_entries( always_yes ) ) {
+        if( entry->is_item() && !entry->is_collated() &&
+            entry->any_item()->display_stacked_with( *loc ) ) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+static void check_lookups_match_linear_search( inventory_column &col,
+        const std::vector<item_location> &locations, const item_location &new_loc )
+{
+    for( const item_location &loc : locations ) {
+        inventory_entry *found = col.find_by_location( loc );
+        if( found == nullptr ) {
+            found = col.find_by_location( loc, true );
+        }
+        CHECK( found != nullptr );
+        CHECK( found == find_by_location_linearly( col, loc ) );
+    }
+
+    // Adding goes through the index, so it has to pick the same stack a search would
+    inventory_entry *const expected = find_stack_linearly( col, new_loc );
+    inventory_entry *const added = col.add_entry( inventory_entry( { new_loc } ) );
+    REQUIRE( added != nullptr );
+    if( expected != nullptr ) {
+        CHECK( added == expected );
+    } else {
+        CHECK( added->locations == std::vector<item_location> { new_loc } );
+    }
+    CHECK( col.find_by_location( new_loc ) == find_by_location_linearly( col, new_loc ) );
+}
+
+TEST_CASE( "inventory_column_lookups_match_linear_search", "[inventory][ui]" )
+{
+    clear_avatar();
+    clear_map();
+    map &here = get_map();
+    const tripoint pos = tripoint_zero;
+
+    std::vector<item_location> locations;
+    const auto spawn = [&]( const itype_id & type, int damage ) {
+        item it( type );
+        it.set_damage( damage );
+        return here.add_item_ret_loc( pos, it );
+    };
+    for( int i = 0; i < 3; i++ ) {
+        locations.push_back( spawn( itype_hammer, 0 ) );
+        locations.push_back( spawn( itype_hammer, 1000 * ( i + 1 ) ) );
+        locations.push_back( spawn( itype_pockknife, 0 ) );
+    }
+
+    const collating_preset preset;
+    inventory_column col( preset );
+    for( const item_location &loc : locations ) {
+        REQUIRE( col.add_entry( inventory_entry( { loc } ) ) != nullptr );
+    }
+
+    SECTION( "after collate" ) {
+        col.collate();
+        check_lookups_match_linear_search( col, locations, spawn( itype_hammer, 0 ) );
+    }
+
+    SECTION( "after collate and uncollate" ) {
+        col.collate();
+        col.uncollate();
+        check_lookups_match_linear_search( col, locations, spawn( itype_hammer, 0 ) );
+    }
+
+    SECTION( "after moving the entries to another column" ) {
+        inventory_column dest( preset );
+        REQUIRE( dest.add_entry( inventory_entry( { spawn( itype_pockknife, 0 ) } ) ) != nullptr );
+        col.move_entries_to( dest );
+        CHECK( col.empty() );
+        check_lookups_match_linear_search( dest, locations, spawn( itype_pockknife, 0 ) );
+    }
+}
@@ -1,7 +1,9 @@
 #include <functional>
+#include <vector>
 
 #include "cata_catch.h"
 #include "item.h"
+#include "item_components.h"
 #include "item_contents.h"
 #include "itype.h"
 #include "map.h"
@@ -142,3 +144,30 @@ TEST_CASE( "overflow_test_into_parent_item", "[item]" )
     }
     CHECK( contents_count == 2 );
 }
+
+TEST_CASE( "item_contents_copy_benchmark", "[.][item][benchmark]" )
+{
+    item tool_belt( "test_tool_belt" );
+    // Crafted items carry the items they were made from
+    item hammer( "hammer_pocket_test" );
+    for( int i = 0; i < 10; ++i ) {
+        item log( itype_log );
+        hammer.components.add( log );
+    }
+    REQUIRE( tool_belt.put_in( hammer, pocket_type::CONTAINER ).success() );
+    REQUIRE( tool_belt.put_in( item( "tongs_pocket_test" ), pocket_type::CONTAINER ).success() );
+    REQUIRE( tool_belt.put_in( item( "wrench_pocket_test" ), pocket_type::CONTAINER ).success() );
+    REQUIRE( tool_belt.put_in( item( itype_crowbar_pocket_test ),
+                               pocket_type::CONTAINER ).success() );
+    // Roughly the cargo of a vehicle part full of filled containers
+    const std::vector<item> cargo( 100, tool_belt );
+
+    BENCHMARK( "copy filled container" ) {
+        const item copy = tool_belt;
+        return copy.num_item_stacks();
+    };
+    BENCHMARK( "copy cargo of filled containers" ) {
+        const std::vector<item> copy = cargo;
+        return copy.size();
+    };
+}
@@ -0,0 +1,54 @@
+#include <string>
+#include <vector>
+
+#include "cata_catch.h"
+#include "filesystem.h"
+#include "flexbuffer_json.h"
+#include "json_loader.h"
+#include "path_info.h"
+
+// Number of entries in a data file, or 1 for a file holding a single object
+static size_t count_entries( const JsonValue &jsin )
+{
+    if( jsin.test_array() ) {
+        return static_cast<JsonArray>( jsin ).size();
+    }
+    return 1;
+}
+
+TEST_CASE( "json_loader_gives_parsed_files_in_order", "[json]" )
+{
+    const std::vector<cata_path> files = get_files_from_path( ".json",
+                                         PATH_INFO::jsondir() / "items", true, true );
+    REQUIRE( files.size() > 1 );
+
+    std::vector<cata_path> loaded;
+    json_loader::for_each_from_paths( files, [&]( const cata_path & file, const JsonValue & jsin ) {
+        CAPTURE( file.generic_u8string() );
+        CHECK( count_entries( jsin ) == count_entries( json_loader::from_path( file ) ) );
+        loaded.push_back( file );
+    } );
+    CHECK( loaded == files );
+}
+
+TEST_CASE( "data_files_parse_benchmark", "[.][json][benchmark]" )
+{
+    const std::vector<cata_path> files = get_files_from_path( ".json", PATH_INFO::jsondir(), true,
+                                         true );
+
+    BENCHMARK( "parse data files one by one" ) {
+        size_t entries = 0;
+        for( const cata_path &file : files ) {
+            entries += count_entries( json_loader::from_path( file ) );
+        }
+        return entries;
+    };
+
+    BENCHMARK( "parse data files ahead on worker threads" ) {
+        size_t entries = 0;
+        json_loader::for_each_from_paths( files, [&]( const cata_path &, const JsonValue & jsin ) {
+            entries += count_entries( jsin );
+        } );
+        return entries;
+    };
+}
@@ -0,0 +1,43 @@
+#include "cata_catch.h"
+#include "los_cache.h"
+#include "point.h"
+
+TEST_CASE( "los_cache_stores_and_clears_results", "[map][nogame]" )
+{
+    los_cache cache;
+    CHECK( cache.get( point( 1, 2 ), -1 ) == -1 );
+
+    cache.insert( point( 1, 2 ), 1 );
+    cache.insert( point( 2, 1 ), 0 );
+    CHECK( cache.get( point( 1, 2 ), -1 ) == 1 );
+    CHECK( cache.get( point( 2, 1 ), -1 ) == 0 );
+
+    cache.insert( point( 1, 2 ), 0 );
+    CHECK( cache.get( point( 1, 2 ), -1 ) == 0 );
+
+    cache.clear();
+    CHECK( cache.get( point( 1, 2 ), -1 ) == -1 );
+    CHECK( cache.get( point( 2, 1 ), -1 ) == -1 );
+}
+
+TEST_CASE( "los_cache_never_returns_wrong_results_when_full", "[map][nogame]" )
+{
+    los_cache cache;
+    // Far more keys than the cache has slots, older ones get lost but never mixed up
+    for( int x = 0; x < 1000; ++x ) {
+        for( int y = 0; y < 300; ++y ) {
+            cache.insert( point( x, y ), ( x + y ) % 2 );
+        }
+    }
+    int found = 0;
+    for( int x = 0; x < 1000; ++x ) {
+        for( int y = 0; y < 300; ++y ) {
+            const char cached = cache.get( point( x, y ), -1 );
+            if( cached >= 0 ) {
+                CHECK( cached == ( x + y ) % 2 );
+                found++;
+            }
+        }
+    }
+    CHECK( found > 0 );
+}
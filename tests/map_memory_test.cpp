@@ -10,6 +10,7 @@
 #include "map.h"
 #include "map_memory.h"
 #include "point.h"
+#include "rng.h"
 
 static constexpr tripoint_abs_ms p1{ -SEEX - 2, -SEEY - 3, -1 };
 static constexpr tripoint_abs_ms p2{ 5, 7, -1 };
@@ -261,3 +262,38 @@ TEST_CASE( "shift_map_memory_bitset_cache" )
         }
     }
 }
+
+template<int SIZE, int MULTIPLIER>
+static void check_shift_matches_bitwise_shift( const point &s )
+{
+    std::bitset<SIZE *SIZE> cache;
+    for( size_t i = 0; i < cache.size(); ++i ) {
+        cache[i] = one_in( 2 );
+    }
+    const std::bitset<SIZE *SIZE> original = cache;
+    shift_bitset_cache<SIZE, MULTIPLIER>( cache, s );
+    const point from_offset = s * MULTIPLIER;
+    for( int y = 0; y < SIZE; ++y ) {
+        for( int x = 0; x < SIZE; ++x ) {
+            const point from = point( x, y ) + from_offset;
+            const bool expected = from.x >= 0 && from.x < SIZE && from.y >= 0 && from.y < SIZE &&
+                                  original[from.y * SIZE + from.x];
+            if( cache[y * SIZE + x] != expected ) {
+                INFO( x << " " << y );
+                CHECK( cache[y * SIZE + x] == expected );
+            }
+        }
+    }
+}
+
+TEST_CASE( "shift_bitset_cache_matches_bitwise_shift" )
+{
+    for( const point &s : {
+             point_east, point_west, point_south, point_north,
+             point_south_east, point_north_east, point_south_west, point_north_west
+         } ) {
+        CAPTURE( s );
+        check_shift_matches_bitwise_shift<MAPSIZE_X, SEEX>( s );
+        check_shift_matches_bitwise_shift<MAPSIZE, 1>( s );
+    }
+}
@@ -0,0 +1,101 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "calendar.h"
+#include "cata_catch.h"
+#include "cata_scope_helpers.h"
+#include "coordinates.h"
+#include "map.h"
+#include "mapbuffer.h"
+#include "mapgen.h"
+#include "omdata.h"
+#include "overmapbuffer.h"
+#include "point.h"
+#include "rng.h"
+#include "submap.h"
+#include "type_id.h"
+
+static const oter_str_id oter_field( "field" );
+static const oter_str_id oter_house_01_north( "house_01_north" );
+static const oter_str_id oter_house_01_roof_north( "house_01_roof_north" );
+static const oter_str_id oter_road_nesw( "road_nesw" );
+static const oter_str_id oter_s_gas_north( "s_gas_north" );
+
+// Far enough from the test map not to touch it, but still on the first overmap
+static const tripoint_abs_omt raster_test_pos( 100, 100, 0 );
+
+using terrain_snapshot = std::vector<std::pair<ter_id, furn_id>>;
+
+static terrain_snapshot generate_terrain( const oter_id &terrain_type, const bool use_rasters )
+{
+    restore_on_out_of_scope<bool> restore_use_rasters( mapgen_use_terrain_rasters );
+    mapgen_use_terrain_rasters = use_rasters;
+
+    overmap_buffer.ter_set( raster_test_pos, terrain_type );
+    const tripoint_abs_sm sm_pos = project_to<coords::sm>( raster_test_pos );
+    // Get rid of the previous generation, or the new one wouldn't be stored
+    MAPBUFFER.clear_outside_reality_bubble();
+
+    rng_set_engine_seed( 1234567 );
+    tinymap tm;
+    tm.generate( sm_pos, calendar::turn );
+
+    terrain_snapshot result;
+    for( const point &sm_offset : { point_zero, point_east, point_south, point_south_east } ) {
+        const submap *sm = MAPBUFFER.lookup_submap( sm_pos + sm_offset );
+        REQUIRE( sm != nullptr );
+        for( int x = 0; x < SEEX; x++ ) {
+            for( int y = 0; y < SEEY; y++ ) {
+                result.emplace_back( sm->get_ter( point( x, y ) ), sm->get_furn( point( x, y ) ) );
+            }
+        }
+    }
+    return result;
+}
+
+// Puts back the overmap terrain at raster_test_pos and drops the submaps generated for it
+static void restore_raster_test_pos( const oter_id &original_terrain )
+{
+    overmap_buffer.ter_set( raster_test_pos, original_terrain );
+    MAPBUFFER.clear_outside_reality_bubble();
+}
+
+static void check_rasters_match_objects( const oter_id &terrain_type )
+{
+    CAPTURE( terrain_type.id().str() );
+    const terrain_snapshot with_rasters = generate_terrain( terrain_type, true );
+    const terrain_snapshot without_rasters = generate_terrain( terrain_type, false );
+    CHECK( with_rasters == without_rasters );
+}
+
+TEST_CASE( "mapgen_terrain_rasters_match_objects", "[mapgen]" )
+{
+    const oter_id original_terrain = overmap_buffer.ter( raster_test_pos );
+    on_out_of_scope restore( [&]() {
+        restore_raster_test_pos( original_terrain );
+    } );
+    // Otherwise there is nothing to compare
+    REQUIRE( mapgen_terrain_raster_objects( oter_house_01_north->get_mapgen_id() ) > 0 );
+    for( const oter_str_id &terrain_type : {
+             oter_field, oter_house_01_north, oter_house_01_roof_north, oter_road_nesw,
+             oter_s_gas_north
+         } ) {
+        check_rasters_match_objects( terrain_type.id() );
+    }
+}
+
+// Generates every overmap terrain twice, takes a while.
+TEST_CASE( "mapgen_terrain_rasters_match_objects_for_all_terrain", "[.][mapgen]" )
+{
+    const oter_id original_terrain = overmap_buffer.ter( raster_test_pos );
+    on_out_of_scope restore( [&]() {
+        restore_raster_test_pos( original_terrain );
+    } );
+    for( const oter_t &terrain_type : overmap_terrains::get_all() ) {
+        if( terrain_type.id.is_null() ) {
+            continue;
+        }
+        check_rasters_match_objects( terrain_type.id.id() );
+    }
+}
@@ -1,14 +1,23 @@
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
 #include "cached_options.h"
 #include "calendar.h"
 #include "cata_catch.h"
 #include "cata_scope_helpers.h"
+#include "game.h"
+#include "game_constants.h"
+#include "item.h"
+#include "line.h"
 #include "map.h"
 #include "map_helpers.h"
+#include "map_iterator.h"
 #include "mapdata.h"
 #include "monster.h"
 #include "options_helpers.h"
-
-struct tripoint;
+#include "point.h"
+#include "type_id.h"
 
 static monster &spawn_and_clear( const tripoint &pos, bool set_floor )
 {
@@ -71,3 +80,88 @@ TEST_CASE( "monsters_should_not_see_through_floors", "[vision]" )
     CHECK( sky.sees( distant ) );
     CHECK( distant.sees( sky ) );
 }
+
+static const efftype_id effect_no_sight( "no_sight" );
+
+static const time_point midnight = calendar::turn_zero;
+
+// Creature::sees( tripoint ) as it was before it started rejecting out of range targets early
+static bool sees_checking_every_range( const Creature &viewer, const tripoint &t, int range_mod )
+{
+    if( std::abs( viewer.posz() - t.z ) > fov_3d_z_range ) {
+        return false;
+    }
+    map &here = get_map();
+    const int range_cur = viewer.sight_range( here.ambient_light_at( t ) );
+    const int range_day = viewer.sight_range( default_daylight_level() );
+    const int range_night = viewer.sight_range( 0 );
+    const int range_max = std::max( range_day, range_night );
+    const int range_min = std::min( range_cur, range_max );
+    const int wanted_range = rl_dist( viewer.pos(), t );
+    const bool artificially_lit = here.ambient_light_at( t ) >
+                                  here.get_cache_ref( t.z ).natural_light_level_cache;
+    if( wanted_range > range_min && ( wanted_range > range_max || !artificially_lit ) ) {
+        return false;
+    }
+    int range = artificially_lit ? MAX_VIEW_DISTANCE : range_min;
+    if( viewer.has_effect( effect_no_sight ) ) {
+        range = 1;
+    }
+    if( range_mod > 0 ) {
+        range = std::min( range, range_mod );
+    }
+    return here.sees( viewer.pos(), t, range );
+}
+
+TEST_CASE( "monster_sees_the_same_points_as_a_full_range_check", "[vision]" )
+{
+    const time_point time = GENERATE( midday, midnight );
+    const int range_mod = GENERATE( 0, 8 );
+    CAPTURE( to_string( time ), range_mod );
+    calendar::turn = time;
+    clear_map();
+    g->reset_light_level();
+
+    map &here = get_map();
+    const tripoint viewer_pos( 60, 60, 0 );
+    monster &viewer = spawn_and_clear( viewer_pos, true );
+    // A light far enough away to be out of range at night unless the lamp lights it
+    const tripoint lamp_pos = viewer_pos + tripoint( 40, 0, 0 );
+    here.add_item( lamp_pos, item( "atomic_lamp" ) );
+    // And a wall to hide some of the points that are in range
+    for( int y = -5; y <= 5; y++ ) {
+        here.ter_set( viewer_pos + tripoint( 2, y, 0 ), t_wall );
+    }
+    here.build_map_cache( 0 );
+
+    int lit = 0;
+    int seen = 0;
+    int unseen_in_range = 0;
+    int out_of_range = 0;
+    std::vector<tripoint> mismatches;
+    for( const tripoint &t : here.points_on_zlevel( 0 ) ) {
+        const bool expected = sees_checking_every_range( viewer, t, range_mod );
+        if( viewer.sees( t, false, range_mod ) != expected ) {
+            mismatches.push_back( t );
+        }
+        const int distance = rl_dist( viewer_pos, t );
+        if( here.ambient_light_at( t ) > here.get_cache_ref( 0 ).natural_light_level_cache ) {
+            lit++;
+        }
+        if( distance > viewer.sight_range( here.ambient_light_at( t ) ) ) {
+            out_of_range++;
+        } else if( expected ) {
+            seen++;
+        } else {
+            unseen_in_range++;
+        }
+    }
+    CHECK( mismatches.empty() );
+    // Make sure every kind of target came up
+    CHECK( seen > 0 );
+    CHECK( unseen_in_range > 0 );
+    CHECK( out_of_range > 0 );
+    if( time == midnight ) {
+        CHECK( lit > 0 );
+    }
+}
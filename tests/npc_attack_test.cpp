@@ -1,8 +1,13 @@
+#include <algorithm>
+#include <optional>
+#include <vector>
+
 #include "catch/catch.hpp"
 
 #include "creature_tracker.h"
 #include "flag.h"
 #include "game.h"
+#include "magic_spell_effect_helpers.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "npc.h"
@@ -23,13 +28,41 @@ static const itype_id itype_wearable_light( "wearable_light" );
 
 static const mtype_id mon_zombie( "mon_zombie" );
 
+static const spell_id spell_test_spell_blast( "test_spell_blast" );
+static const spell_id spell_test_spell_blast_projectile( "test_spell_blast_projectile" );
+
 static const string_id<npc_template> npc_template_test_talker( "test_talker" );
 
+static const ter_str_id ter_t_wall( "t_wall" );
+
 static const weather_type_id weather_sunny( "sunny" );
 
 static constexpr point main_npc_start{ 50, 50 };
 static constexpr tripoint main_npc_start_tripoint{ main_npc_start, 0 };
 
+class npc_attack_spell_test_helper
+{
+    public:
+        // What all_evaluations would give for location without skipping any blast areas
+        static npc_attack_rating evaluate_unpruned( const npc_attack_spell &attack,
+                const npc &source, const Creature *target, const tripoint &location ) {
+            npc_attack_rating rating = attack.evaluate_tripoint( source, target, location );
+            rating -= attack.base_time_penalty( source );
+            return rating;
+        }
+        // What all_evaluations gives for location, skipping the area if nobody can be hit
+        static npc_attack_rating evaluate_pruned( const npc_attack_spell &attack,
+                const npc &source, const Creature *target, const tripoint &location ) {
+            const std::optional<std::vector<tripoint>> creatures =
+                        attack.creatures_in_reach( source );
+            REQUIRE( creatures );
+            npc_attack_rating rating = attack.evaluate_tripoint_pruned( source, target, location,
+                                       creatures );
+            rating -= attack.base_time_penalty( source );
+            return rating;
+        }
+};
+
 namespace npc_attack_setup
 {
 static npc &spawn_main_npc()
@@ -309,6 +342,108 @@ TEST_CASE( "NPC_faces_zombies", "[npc_attack]" )
     }
 }
 
+TEST_CASE( "NPC_rates_blast_spell_targets", "[npc_attack]" )
+{
+    get_player_character().setpos( main_npc_start_tripoint );
+    clear_map_and_put_player_underground();
+    clear_vehicles();
+    scoped_weather_override sunny_weather( weather_sunny );
+    npc &main_npc = npc_attack_setup::respawn_main_npc();
+    main_npc.magic->learn_spell( spell_test_spell_blast, main_npc, true );
+    monster *zombie = npc_attack_setup::spawn_zombie_at_range( 5 );
+    REQUIRE( zombie != nullptr );
+    REQUIRE( main_npc.sees( *zombie ) );
+
+    const int aoe = 2;
+    const npc_attack_spell attack( spell_test_spell_blast );
+    const std::vector<npc_attack_rating> ratings = attack.all_evaluations( main_npc, zombie );
+    REQUIRE_FALSE( ratings.empty() );
+
+    THEN( "Points with nobody in the blast all rate the same" ) {
+        std::optional<int> empty_rating;
+        for( const npc_attack_rating &rating : ratings ) {
+            if( square_dist( rating.target(), zombie->pos() ) <= aoe ||
+                square_dist( rating.target(), main_npc.pos() ) <= aoe ) {
+                continue;
+            }
+            CAPTURE( rating.target() );
+            REQUIRE( rating.value() );
+            if( !empty_rating ) {
+                empty_rating = rating.value();
+            }
+            CHECK( *rating.value() == *empty_rating );
+        }
+        CHECK( empty_rating );
+    }
+
+    THEN( "Skipping empty blast areas doesn't change any rating" ) {
+        const std::vector<tripoint> points =
+            main_npc.magic->get_spell( spell_test_spell_blast ).targetable_locations( main_npc );
+        REQUIRE( points.size() == ratings.size() );
+        // The zombie is at the very edge of the blast from here, so it must not be skipped
+        const tripoint edge_point = zombie->pos() + tripoint( aoe, 0, 0 );
+        REQUIRE( std::find( points.begin(), points.end(), edge_point ) != points.end() );
+        const tripoint empty_point = zombie->pos() + tripoint( aoe + 1, 0, 0 );
+        REQUIRE( std::find( points.begin(), points.end(), empty_point ) != points.end() );
+        CHECK( npc_attack_spell_test_helper::evaluate_unpruned( attack, main_npc, zombie,
+                edge_point ).value() !=
+               npc_attack_spell_test_helper::evaluate_unpruned( attack, main_npc, zombie,
+                       empty_point ).value() );
+
+        for( size_t i = 0; i < points.size(); ++i ) {
+            CAPTURE( points[i] );
+            const npc_attack_rating expected = npc_attack_spell_test_helper::evaluate_unpruned(
+                                                   attack, main_npc, zombie, points[i] );
+            CHECK( ratings[i].target() == expected.target() );
+            CHECK( ratings[i].value() == expected.value() );
+        }
+    }
+
+    THEN( "The best target hits the zombie" ) {
+        const npc_attack_rating best = attack.evaluate( main_npc, zombie );
+        REQUIRE( best.value() );
+        CHECK( square_dist( best.target(), zombie->pos() ) <= aoe );
+    }
+}
+
+TEST_CASE( "NPC_rates_projectile_blast_spell_stopped_by_a_wall", "[npc_attack]" )
+{
+    get_player_character().setpos( main_npc_start_tripoint );
+    clear_map_and_put_player_underground();
+    clear_vehicles();
+    scoped_weather_override sunny_weather( weather_sunny );
+    npc &main_npc = npc_attack_setup::respawn_main_npc();
+    main_npc.magic->learn_spell( spell_test_spell_blast_projectile, main_npc, true );
+    monster *zombie = g->place_critter_at( mon_zombie, main_npc.pos() + tripoint( 0, 5, 0 ) );
+    REQUIRE( zombie != nullptr );
+    get_map().ter_set( main_npc.pos() + tripoint( 2, 0, 0 ), ter_t_wall );
+
+    const int aoe = 2;
+    const npc_attack_spell attack( spell_test_spell_blast_projectile );
+    const spell &attack_spell = main_npc.magic->get_spell( spell_test_spell_blast_projectile );
+
+    // Nobody is near the point aimed at, but the blast stops right next to the caster
+    const tripoint past_wall = main_npc.pos() + tripoint( 6, 0, 0 );
+    REQUIRE( square_dist( past_wall, zombie->pos() ) > aoe );
+    const tripoint epicenter = spell_effect_epicenter( attack_spell, past_wall, main_npc );
+    REQUIRE( epicenter == main_npc.pos() + tripoint( 1, 0, 0 ) );
+    CHECK( npc_attack_spell_test_helper::evaluate_pruned( attack, main_npc, zombie,
+            past_wall ).value() ==
+           npc_attack_spell_test_helper::evaluate_unpruned( attack, main_npc, zombie,
+                   past_wall ).value() );
+
+    const std::vector<tripoint> points = attack_spell.targetable_locations( main_npc );
+    const std::vector<npc_attack_rating> ratings = attack.all_evaluations( main_npc, zombie );
+    REQUIRE( points.size() == ratings.size() );
+    for( size_t i = 0; i < points.size(); ++i ) {
+        CAPTURE( points[i] );
+        const npc_attack_rating expected = npc_attack_spell_test_helper::evaluate_unpruned(
+                                               attack, main_npc, zombie, points[i] );
+        CHECK( ratings[i].target() == expected.target() );
+        CHECK( ratings[i].value() == expected.value() );
+    }
+}
+
 // TODO: Add scenarios for:
 // - NPCs carrying a mix of weapons
 // - NPCs trying to shoot through allies
@@ -0,0 +1,39 @@
+#include "cata_catch.h"
+#include "game.h"
+#include "game_constants.h"
+#include "map.h"
+#include "point.h"
+#include "scent_map.h"
+
+static int scent_pattern( const point &p )
+{
+    return 1 + p.x * MAPSIZE_Y + p.y;
+}
+
+TEST_CASE( "scent_map_shift_moves_scent_with_the_map", "[scent]" )
+{
+    const int z = get_map().get_abs_sub().z();
+    for( const point &shift : {
+             point( SEEX, 0 ), point( -SEEX, 0 ), point( 0, SEEY ), point( 0, -SEEY ),
+             point( SEEX, -SEEY ), point( -2 * SEEX, 3 * SEEY ), point( MAPSIZE_X, 0 )
+         } ) {
+        CAPTURE( shift );
+        scent_map scent( *g );
+        for( int x = 0; x < MAPSIZE_X; ++x ) {
+            for( int y = 0; y < MAPSIZE_Y; ++y ) {
+                scent.set_unsafe( tripoint( x, y, z ), scent_pattern( point( x, y ) ) );
+            }
+        }
+        scent.shift( shift );
+        for( int x = 0; x < MAPSIZE_X; ++x ) {
+            for( int y = 0; y < MAPSIZE_Y; ++y ) {
+                const point from = point( x, y ) + shift;
+                const int expected = scent.inbounds( from ) ? scent_pattern( from ) : 0;
+                if( scent.get_unsafe( tripoint( x, y, z ) ) != expected ) {
+                    CAPTURE( x, y );
+                    CHECK( scent.get_unsafe( tripoint( x, y, z ) ) == expected );
+                }
+            }
+        }
+    }
+}
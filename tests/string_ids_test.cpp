@@ -3,6 +3,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -68,6 +69,39 @@ TEST_CASE( "string_ids_intern_test", "[string_id]" )
     }
 }
 
+TEST_CASE( "string_ids_intern_on_several_threads", "[string_id]" )
+{
+    static constexpr int num_threads = 4;
+    static constexpr int num_ids = 20000;
+
+    struct test_obj {};
+    // Every thread interns the same strings, in a different order
+    std::vector<std::vector<string_id<test_obj>>> ids( num_threads );
+    std::vector<std::thread> threads;
+    for( int t = 0; t < num_threads; ++t ) {
+        threads.emplace_back( [t, &ids]() {
+            std::vector<string_id<test_obj>> &thread_ids = ids[t];
+            thread_ids.resize( num_ids );
+            for( int n = 0; n < num_ids; ++n ) {
+                const int i = t % 2 ? num_ids - 1 - n : n;
+                thread_ids[i] = string_id<test_obj>( "threaded_test_id" + std::to_string( i ) );
+            }
+        } );
+    }
+    for( std::thread &thread : threads ) {
+        thread.join();
+    }
+
+    for( int i = 0; i < num_ids; ++i ) {
+        CAPTURE( i );
+        CHECK( ids[0][i].str() == "threaded_test_id" + std::to_string( i ) );
+        for( int t = 1; t < num_threads; ++t ) {
+            CHECK( ids[t][i] == ids[0][i] );
+            CHECK( &ids[t][i].str() == &ids[0][i].str() );
+        }
+    }
+}
+
 TEST_CASE( "string_ids_collection_equality", "[string_id]" )
 {
     struct test_obj {};
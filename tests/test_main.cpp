@@ -318,6 +318,9 @@ int main( int argc, const char *argv[] )
                  | Opt( error_fmt, "human-readable|github-action" )
                  ["--error-format"]
                  ( "[CataclysmDDA] Format of error messages (default: human-readable)" )
+                 | Opt( data_snapshot )
+                 ["--data-snapshot"]
+                 ( "[CataclysmDDA] Load each data folder from one snapshot of its parsed json." )
                  | Opt( check_plural_str, "none|certain|possbile" )
                  ["--check-plural"]
                  ( "[CataclysmDDA] (TBW)" )
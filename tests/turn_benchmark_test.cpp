@@ -0,0 +1,138 @@
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#endif
+
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "cata_utility.h"
+#include "do_turn.h"
+#include "field_type.h"
+#include "game.h"
+#include "item.h"
+#include "json.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "rng.h"
+#include "turn_profiler.h"
+#include "type_id.h"
+#include "units.h"
+#include "vehicle.h"
+
+static const itype_id itype_log( "log" );
+
+static const ter_str_id ter_t_floor( "t_floor" );
+static const ter_str_id ter_t_pavement( "t_pavement" );
+
+static const vproto_id vehicle_prototype_car( "car" );
+
+// Size of the benchmark scenario, the defaults take a few seconds on a desktop
+static constexpr int num_zombies = 60;
+static constexpr int num_npcs = 4;
+static constexpr int num_fires = 6;
+// Long enough to cover a horde movement (every 2.5 minutes) a few times
+static constexpr int num_turns = 600;
+
+// Peak resident set size of the process in kilobytes, or -1 if it is not known
+static int64_t peak_rss_kb()
+{
+#if defined(__linux__)
+    rusage usage {};
+    if( getrusage( RUSAGE_SELF, &usage ) == 0 ) {
+        return usage.ru_maxrss;
+    }
+#endif
+    return -1;
+}
+
+static vehicle &setup_turn_benchmark()
+{
+    rng_set_engine_seed( 4242424242 );
+    clear_map();
+    clear_avatar();
+    set_time_to_day();
+    build_test_map( ter_t_pavement.id() );
+    map &here = get_map();
+
+    // Keep the player out of the way, so the monsters go after the NPCs and the game can't end
+    const tripoint player_pos( 0, 0, -2 );
+    here.ter_set( player_pos, ter_t_floor );
+    get_avatar().setpos( player_pos );
+
+    for( int i = 0; i < num_zombies; ++i ) {
+        spawn_test_monster( "mon_zombie", tripoint( 40 + 2 * ( i % 10 ), 40 + 2 * ( i / 10 ), 0 ) );
+    }
+    for( int i = 0; i < num_npcs; ++i ) {
+        spawn_npc( point( 60 + 2 * i, 70 ), "test_talker" );
+    }
+    for( int i = 0; i < num_fires; ++i ) {
+        const tripoint fire_pos( 80 + 3 * i, 45, 0 );
+        here.add_item( fire_pos, item( itype_log ) );
+        here.add_field( fire_pos, fd_fire, 3, 1_hours );
+    }
+
+    vehicle *veh = here.add_vehicle( vehicle_prototype_car, tripoint( 40, 85, 0 ), 0_degrees, 100, 0 );
+    REQUIRE( veh != nullptr );
+    veh->tags.insert( "IN_CONTROL_OVERRIDE" );
+    veh->engine_on = true;
+    veh->cruise_velocity = 500;
+    veh->velocity = 500;
+    here.build_map_cache( 0 );
+    return *veh;
+}
+
+// Not a Catch BENCHMARK because the game state changes with every turn, so the runs are
+// not repeatable. Run with `cata_test [turn_benchmark]`, a build with PROFILER=1 also
+// reports the time spent in each stage of the turn.
+TEST_CASE( "turn_benchmark", "[.][benchmark][turn_benchmark]" )
+{
+    vehicle &veh = setup_turn_benchmark();
+    avatar &u = get_avatar();
+
+    turn_profiler::start();
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for( int turn = 0; turn < num_turns; ++turn ) {
+        // Keep the player from taking input, they only wait for the world to move
+        u.moves = 0;
+        // Drive back and forth to stay inside the reality bubble
+        if( turn % 60 == 59 ) {
+            veh.cruise_velocity = -veh.cruise_velocity;
+        }
+        REQUIRE_FALSE( do_turn() );
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    turn_profiler::stop();
+
+    using ms = std::chrono::duration<double, std::milli>;
+    const std::string path = "turn_benchmark.json";
+    write_to_file( path, [&]( std::ostream & fout ) {
+        JsonOut jsout( fout, true );
+        jsout.start_object();
+        jsout.member( "turns", num_turns );
+        jsout.member( "seconds", elapsed.count() );
+        jsout.member( "turns_per_second", num_turns / elapsed.count() );
+        jsout.member( "peak_rss_kb", peak_rss_kb() );
+        jsout.member( "zones" );
+        jsout.start_array();
+        for( const turn_profiler::zone_stats &stats : turn_profiler::get_stats() ) {
+            jsout.start_object();
+            jsout.member( "name", stats.name );
+            jsout.member( "depth", stats.depth );
+            jsout.member( "calls", stats.count );
+            jsout.member( "total_ms", ms( stats.total ).count() );
+            jsout.member( "max_per_turn_ms", ms( stats.max_per_turn ).count() );
+            jsout.end_object();
+        }
+        jsout.end_array();
+        jsout.end_object();
+    } );
+    WARN( "turn benchmark results written to " << path );
+}
@@ -0,0 +1,52 @@
+#include <vector>
+
+#include "cata_catch.h"
+#include "turn_profiler.h"
+
+TEST_CASE( "turn_profiler_records_nested_zones", "[profiler][nogame]" )
+{
+    turn_profiler::start();
+    for( int turn = 0; turn < 3; ++turn ) {
+        turn_profiler::zone outer( "outer" );
+        for( int i = 0; i < 2; ++i ) {
+            turn_profiler::zone inner( "inner" );
+        }
+    }
+    turn_profiler::end_turn();
+    turn_profiler::stop();
+    // Zones are not recorded once the profiler is stopped
+    {
+        turn_profiler::zone ignored( "ignored" );
+    }
+
+    // Stopping right after the end of a turn doesn't add an empty one
+    CHECK( turn_profiler::recorded_turns() == 1 );
+    const std::vector<turn_profiler::zone_stats> stats = turn_profiler::get_stats();
+    REQUIRE( stats.size() == 2 );
+    CHECK( stats[0].name == "outer" );
+    CHECK( stats[0].depth == 0 );
+    CHECK( stats[0].count == 3 );
+    CHECK( stats[1].name == "inner" );
+    CHECK( stats[1].depth == 1 );
+    CHECK( stats[1].count == 6 );
+    CHECK( stats[1].total <= stats[0].total );
+    CHECK( stats[0].max_per_turn <= stats[0].total );
+}
+
+TEST_CASE( "turn_profiler_stop_ends_the_turn_in_progress", "[profiler][nogame]" )
+{
+    turn_profiler::start();
+    {
+        turn_profiler::zone first( "first" );
+    }
+    turn_profiler::end_turn();
+    {
+        turn_profiler::zone second( "second" );
+    }
+    turn_profiler::stop();
+    CHECK( turn_profiler::recorded_turns() == 2 );
+
+    turn_profiler::start();
+    turn_profiler::stop();
+    CHECK( turn_profiler::recorded_turns() == 0 );
+}
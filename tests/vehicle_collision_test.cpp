@@ -0,0 +1,67 @@
+#include <vector>
+
+#include "cata_catch.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "type_id.h"
+#include "units.h"
+#include "vehicle.h"
+
+static const ter_str_id ter_t_pavement( "t_pavement" );
+static const ter_str_id ter_t_wall( "t_wall" );
+
+static const vproto_id vehicle_prototype_car( "car" );
+
+// The first part of the car that would move onto the tile east of its front
+static tripoint front_of( vehicle &veh )
+{
+    tripoint front = veh.global_pos3();
+    for( const tripoint &p : veh.get_points( true ) ) {
+        if( p.x > front.x ) {
+            front = p;
+        }
+    }
+    return front + tripoint_east;
+}
+
+static std::vector<veh_collision> detect_collisions( vehicle &veh )
+{
+    std::vector<veh_collision> colls;
+    veh.precalc_mounts( 1, veh.turn_dir, veh.pivot_point() );
+    veh.collision( colls, tripoint_east, true );
+    return colls;
+}
+
+TEST_CASE( "vehicle_collision_detection", "[vehicle]" )
+{
+    clear_map();
+    clear_avatar();
+    map &here = get_map();
+    vehicle *veh_ptr = here.add_vehicle( vehicle_prototype_car, tripoint( 60, 60, 0 ), 0_degrees,
+                                         0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+    const tripoint obstacle = front_of( veh );
+
+    SECTION( "nothing in the way on grass or pavement" ) {
+        CHECK( detect_collisions( veh ).empty() );
+        here.ter_set( obstacle, ter_t_pavement );
+        CHECK( detect_collisions( veh ).empty() );
+    }
+
+    SECTION( "wall in the way" ) {
+        here.ter_set( obstacle, ter_t_wall );
+        const std::vector<veh_collision> colls = detect_collisions( veh );
+        REQUIRE( colls.size() == 1 );
+        CHECK( colls.front().type == veh_coll_other );
+    }
+
+    SECTION( "monster in the way" ) {
+        spawn_test_monster( "mon_zombie", obstacle );
+        const std::vector<veh_collision> colls = detect_collisions( veh );
+        REQUIRE( colls.size() == 1 );
+        CHECK( colls.front().type == veh_coll_body );
+    }
+}
@@ -1,4 +1,5 @@
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include "avatar.h"
@@ -780,3 +781,43 @@ TEST_CASE( "autopilot_tests", "[vehicle][autopilot]" )
     CHECK( test_autopilot_moving( vehicle_prototype_car, vpart_id::NULL_ID() ) == 0 );
     CHECK( test_autopilot_moving( vehicle_prototype_car, vpart_programmable_autopilot ) == 9 );
 }
+
+using vehicle_cache_snapshot = std::vector<std::pair<const vehicle *, int>>;
+
+static vehicle_cache_snapshot snapshot_vehicle_cache( const map &here )
+{
+    vehicle_cache_snapshot result;
+    for( int x = 40; x < 90; x++ ) {
+        for( int y = 40; y < 90; y++ ) {
+            const optional_vpart_position vp = here.veh_at( tripoint( x, y, 0 ) );
+            if( vp ) {
+                result.emplace_back( &vp->vehicle(), static_cast<int>( vp->part_index() ) );
+            } else {
+                result.emplace_back( nullptr, -1 );
+            }
+        }
+    }
+    return result;
+}
+
+TEST_CASE( "displaced_vehicle_cache_matches_rebuilt_cache", "[vehicle]" )
+{
+    clear_map();
+    map &here = get_map();
+    vehicle *veh_ptr = here.add_vehicle( vehicle_prototype_car, tripoint( 60, 60, 0 ), 0_degrees,
+                                         0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    // Another vehicle nearby, out of the way of the car
+    here.add_vehicle( vehicle_prototype_bicycle, tripoint( 85, 45, 0 ), 90_degrees, 0, 0 );
+    // Moves by one tile, crossing submap borders, and by more than the vehicle's length
+    for( const tripoint &dp : {
+             tripoint_east, tripoint_east, tripoint_south, tripoint_north_west,
+             tripoint( -6, 0, 0 ), tripoint( 3, 9, 0 ), tripoint( 0, -12, 0 )
+         } ) {
+        CAPTURE( dp );
+        REQUIRE( here.displace_vehicle( *veh_ptr, dp ) );
+        const vehicle_cache_snapshot displaced = snapshot_vehicle_cache( here );
+        here.rebuild_vehicle_level_caches();
+        CHECK( displaced == snapshot_vehicle_cache( here ) );
+    }
+}
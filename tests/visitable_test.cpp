@@ -7,8 +7,13 @@
 #include "ret_val.h"
 #include "type_id.h"
 
+static const itype_id itype_test_gum( "test_gum" );
 static const itype_id itype_water( "water" );
 
+static const quality_id qual_AXE( "AXE" );
+static const quality_id qual_HAMMER( "HAMMER" );
+static const quality_id qual_PRY( "PRY" );
+
 TEST_CASE( "visitable_summation" )
 {
     inventory test_inv;
@@ -24,3 +29,52 @@ TEST_CASE( "visitable_summation" )
 
     CHECK( test_inv.charges_of( itype_water, item::INFINITE_CHARGES ) > 1 );
 }
+
+TEST_CASE( "inventory_stacks_only_with_same_type", "[inventory]" )
+{
+    inventory test_inv;
+
+    const item gum( "test_gum", calendar::turn_zero, item::default_charges_tag{} );
+    const item halligan( "test_halligan", calendar::turn_zero );
+    const item fire_ax( "test_fire_ax", calendar::turn_zero );
+
+    for( int i = 0; i < 3; ++i ) {
+        test_inv.add_item( halligan, false, false );
+        test_inv.add_item( gum, false, false );
+        test_inv.add_item( fire_ax, false, false );
+    }
+    // Counted by charges, so all the gum is merged into a single item.
+    CHECK( test_inv.size() == 3 );
+    CHECK( test_inv.charges_of( itype_test_gum ) == 3 * gum.charges );
+
+    // Removing a whole stack must not leave the stacking lookup pointing at it.
+    test_inv.remove_item( test_inv.position_by_type( gum.typeId() ) );
+    CHECK( test_inv.size() == 2 );
+    test_inv.add_item( gum, false, false );
+    test_inv.add_item( gum, false, false );
+    CHECK( test_inv.size() == 3 );
+    CHECK( test_inv.charges_of( itype_test_gum ) == 2 * gum.charges );
+
+    // Copies must not share the lookup with the original.
+    inventory copy_inv = test_inv;
+    copy_inv.add_item( halligan, false, false );
+    CHECK( copy_inv.size() == 3 );
+    CHECK( copy_inv.amount_of( halligan.typeId() ) == 4 );
+    CHECK( test_inv.amount_of( halligan.typeId() ) == 3 );
+}
+
+TEST_CASE( "inventory_max_quality", "[inventory]" )
+{
+    inventory test_inv;
+    test_inv.add_item( item( "test_halligan" ), false, false );
+
+    CHECK( test_inv.max_quality( qual_PRY ) == 4 );
+    CHECK( test_inv.has_quality( qual_HAMMER, 2 ) );
+    CHECK_FALSE( test_inv.has_quality( qual_HAMMER, 3 ) );
+    CHECK_FALSE( test_inv.has_quality( qual_AXE ) );
+
+    // Adding items must refresh the cached levels.
+    test_inv.add_item( item( "test_fire_ax" ), false, false );
+    CHECK( test_inv.max_quality( qual_AXE ) > 0 );
+    CHECK( test_inv.has_quality( qual_AXE ) );
+}